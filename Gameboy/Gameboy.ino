@@ -9,6 +9,7 @@
 #include "src/Game2048/definitions.h"
 #include "src/Game2048/Game2048.h"
 #include "src/minesweeper/minesweeper.h"
+#include "src/latency/latency.h"
 
 // External functions from main.cpp
 extern void pacmanGameSetup();
@@ -45,7 +46,7 @@ enum GameState {
 
 GameState currentState = MENU;
 int menuSelection = 0;
-const int NUM_GAMES = 7;
+const int NUM_GAMES = 8;
 const int GAMES_PER_PAGE = 4;  // How many games to show per page
 int currentPage = 0;            // Current page index
 const int NUM_PAGES = (NUM_GAMES + GAMES_PER_PAGE - 1) / GAMES_PER_PAGE;  // Calculate total pages
@@ -62,7 +63,8 @@ const char* gameNames[] = {
   "4. SNAKE",
   "5. BREAKOUT",
   "6. 2048",
-  "7. MINESWEEPER"
+  "7. MINESWEEPER",
+  "8. TETRIS VS"
 }; 
 
 void drawMenu() {
@@ -231,11 +233,18 @@ void handleMenu() {
       case 5:
         currentState = _2048;
         game2048.begin();
+        latencyBegin(LAT_2048);
         break;
 
       case 6:
         currentState = MINESWEEPER;
         setupMinesweeper();
+        latencyBegin(LAT_MINESWEEPER, LAT_BUTTON);  // Reveals on release
+        break;
+
+      case 7:
+        currentState = TETRIS;  // Same game loop, linked over Serial
+        tetrisVersusSetup();
         break;
     }
   }
@@ -313,6 +322,7 @@ void loop() {
 
     case _2048:
       if (game2048.update() == false){
+      latencyEnd();
       currentState = MENU;
       drawMenu();
     }
@@ -320,6 +330,7 @@ void loop() {
 
     case MINESWEEPER:
       if (loopMinesweeper() == false){
+      latencyEnd();
       currentState = MENU;
       drawMenu();
     }
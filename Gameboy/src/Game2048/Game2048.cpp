@@ -1,4 +1,5 @@
 #include "Game2048.h"
+#include "../latency/latency.h"
 
 #define Pushbutton 8
 
@@ -48,6 +49,7 @@ void Game2048::handleJoystick() {
   if(gameStatus() != 2) {
     over = false;
     // Read joystick values
+    latencyPoll();
     int joyX = analogRead(JOY_X);
     int joyY = analogRead(JOY_Y);
     
@@ -80,6 +82,7 @@ void Game2048::handleJoystick() {
       
       if(moved) {
         showBoard();
+        latencyFrame();
         moveInProgress = true;
         delay(300);  // Delay to prevent multiple moves
       }
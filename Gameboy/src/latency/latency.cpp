@@ -0,0 +1,88 @@
+#include "latency.h"
+
+#if LATENCY_TRACE && defined(ARDUINO)
+#include <Arduino.h>
+
+// Controls, defined in the main sketch
+extern const int joyX;
+extern const int joyY;
+extern const int joyButton;
+extern const int button;
+
+// Same deadzone the menu uses
+#define LAT_JOY_THRESHOLD 200
+// Don't sample more often than this from yield()
+#define LAT_POLL_INTERVAL_US 1000UL
+
+static const char* const channelNames[LAT_CHANNELS] = {
+  "MINESWEEPER",
+  "2048"
+};
+
+static LatencyRecorder recorders[LAT_CHANNELS];
+static uint8_t activeChannel = LAT_NONE;
+static uint32_t lastPollUs = 0;
+
+// pack stick direction and both buttons into one byte so any change is an edge
+static uint8_t readInputs() {
+  uint8_t state = 0;
+  int x = analogRead(joyX);
+  int y = analogRead(joyY);
+  if (x > 512 + LAT_JOY_THRESHOLD) state |= LAT_STICK_RIGHT;
+  else if (x < 512 - LAT_JOY_THRESHOLD) state |= LAT_STICK_LEFT;
+  if (y > 512 + LAT_JOY_THRESHOLD) state |= LAT_STICK_DOWN;
+  else if (y < 512 - LAT_JOY_THRESHOLD) state |= LAT_STICK_UP;
+  if (!digitalRead(joyButton)) state |= LAT_JOY_BUTTON;
+  if (!digitalRead(button)) state |= LAT_BUTTON;
+  return state;
+}
+
+void latencyBegin(LatencyChannel ch, uint8_t release) {
+  activeChannel = ch;
+  if (ch == LAT_NONE) return;
+  recorders[ch].reset(readInputs(), release);
+  lastPollUs = micros();
+}
+
+void latencyPoll() {
+  if (activeChannel == LAT_NONE) return;
+  uint32_t now = micros();
+  lastPollUs = now;
+  recorders[activeChannel].poll(readInputs(), now);
+}
+
+void latencyFrame() {
+  if (activeChannel == LAT_NONE) return;
+  recorders[activeChannel].displayWrite(micros());
+}
+
+void latencyEnd() {
+  if (activeChannel == LAT_NONE) return;
+  LatencyRecorder &r = recorders[activeChannel];
+
+  Serial.print("LATENCY ");
+  Serial.print(channelNames[activeChannel]);
+  Serial.print(" n=");
+  Serial.print(r.samples);
+  Serial.print(" dropped=");
+  Serial.print(r.dropped);
+  Serial.print(" max_us=");
+  Serial.println(r.maxUs);
+  for (uint8_t b = 0; b < LATENCY_BINS; b++) {
+    Serial.print("  >=");
+    Serial.print(LatencyRecorder::binLowMs(b));
+    Serial.print("ms: ");
+    Serial.println(r.bins[b]);
+  }
+
+  activeChannel = LAT_NONE;
+}
+
+// delay() spins on yield(), so edges that happen while a game sleeps
+// still get an accurate timestamp.
+void yield() {
+  if (activeChannel == LAT_NONE) return;
+  if (micros() - lastPollUs < LAT_POLL_INTERVAL_US) return;
+  latencyPoll();
+}
+#endif
@@ -0,0 +1,162 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+
+// Input-to-photon latency instrumentation.
+//
+// An input edge (stick deflected or pushed another way, a button pressed)
+// arms the active channel with a timestamp. The first display update that
+// reflects an input closes it and the elapsed time goes into a histogram.
+// Letting go is not an edge, except for inputs a game acts on when they are
+// released; letting go of the input behind a pending edge that nothing was
+// drawn for forgets it, so an input the game ignored never turns into a
+// sample that runs on into the player's idle time.
+// Edges are sampled from the games' own input reads and, while a game sleeps
+// in delay(), from the core's yield() hook, so time spent waiting for the
+// next loop iteration is counted too.
+//
+// Set LATENCY_TRACE to 0 to compile all hooks down to nothing.
+#ifndef LATENCY_TRACE
+#define LATENCY_TRACE 1
+#endif
+
+// Histogram buckets are powers of two in milliseconds:
+// [0,1) [1,2) [2,4) ... [256,512) [512,inf)
+#define LATENCY_BINS 11
+
+// An armed edge older than this was never drawn and counts as dropped
+#define LATENCY_STALE_US 1000000UL
+
+// Input bits as latencyPoll() packs them
+#define LAT_STICK_RIGHT 1
+#define LAT_STICK_LEFT 2
+#define LAT_STICK_DOWN 4
+#define LAT_STICK_UP 8
+#define LAT_JOY_BUTTON 16
+#define LAT_BUTTON 32
+
+// one histogram per instrumented game
+enum LatencyChannel {
+  LAT_MINESWEEPER,
+  LAT_2048,
+  LAT_CHANNELS,
+  LAT_NONE = LAT_CHANNELS
+};
+
+// Latency histogram for one game. No hardware access, so the host build
+// drives exactly the same code with scripted input states and timestamps.
+struct LatencyRecorder {
+  uint16_t bins[LATENCY_BINS];
+  uint16_t samples;      // edges matched with a display update
+  uint16_t dropped;      // edges that never showed up on screen
+  uint32_t maxUs;        // worst latency seen
+  uint32_t edgeUs;       // timestamp of the oldest unreflected edge
+  bool armed;
+  uint8_t lastInput;     // LAT_* bits as last polled
+  uint8_t releaseInputs; // inputs the game acts on when let go
+  uint8_t armedBy;       // inputs whose edge is pending
+
+  // start over from the inputs in state. releaseInputs are the LAT_*
+  // inputs the game acts on when let go.
+  void reset(uint8_t state = 0, uint8_t release = 0) {
+    for (uint8_t i = 0; i < LATENCY_BINS; i++) bins[i] = 0;
+    samples = dropped = 0;
+    maxUs = edgeUs = 0;
+    armed = false;
+    lastInput = state;
+    releaseInputs = release;
+    armedBy = 0;
+  }
+
+  // the inputs (LAT_* bits) as sampled at nowUs. Pressing an input (or
+  // letting go of one in releaseInputs) is an edge.
+  void poll(uint8_t state, uint32_t nowUs) {
+    if (state == lastInput) return;
+    uint8_t pressed = state & ~lastInput;
+    uint8_t released = lastInput & ~state;
+    lastInput = state;
+
+    uint8_t acted = (pressed & ~releaseInputs) | (released & releaseInputs);
+    uint8_t letGo = released & ~releaseInputs;
+    // forget the pending edge once its input is let go with nothing
+    // drawn, or, for an input acted on when let go, once the player
+    // presses something else with nothing drawn
+    if (!armed) armedBy = 0;
+    if ((letGo & armedBy) || (armedBy && !(armedBy & state) && pressed)) {
+      inputRelease();
+      armedBy = 0;
+    }
+    if (acted) {
+      bool wasArmed = armed;
+      uint32_t oldEdgeUs = edgeUs;
+      inputEdge(nowUs);
+      if (!wasArmed || edgeUs != oldEdgeUs) armedBy = acted;  // owns the timestamp now
+    }
+  }
+
+  // input edge seen at nowUs. Only the oldest unreflected edge is kept.
+  void inputEdge(uint32_t nowUs) {
+    if (armed && nowUs - edgeUs < LATENCY_STALE_US) return;
+    if (armed) dropped++;
+    edgeUs = nowUs;
+    armed = true;
+  }
+
+  // the input behind the pending edge was let go before anything was
+  // drawn for it: the game ignored it, so it is neither a sample nor a drop
+  void inputRelease() {
+    armed = false;
+  }
+
+  // display update finished at nowUs
+  void displayWrite(uint32_t nowUs) {
+    if (!armed) return;
+    armed = false;
+    uint32_t us = nowUs - edgeUs;
+    if (us > maxUs) maxUs = us;
+    if (samples < 0xFFFF) samples++;
+    uint8_t b = binFor(us);
+    if (bins[b] < 0xFFFF) bins[b]++;
+  }
+
+  // histogram bucket for a latency in microseconds
+  static uint8_t binFor(uint32_t us) {
+    uint32_t ms = us / 1000;
+    uint8_t b = 0;
+    while (ms > 0 && b < LATENCY_BINS - 1) {
+      ms >>= 1;
+      b++;
+    }
+    return b;
+  }
+
+  // lower edge of a bucket in milliseconds
+  static uint16_t binLowMs(uint8_t b) {
+    return b == 0 ? 0 : (uint16_t)1 << (b - 1);
+  }
+};
+
+#if LATENCY_TRACE && defined(ARDUINO)
+// select the histogram that edges and frames are charged to.
+// releaseInputs are the LAT_* inputs the game acts on when let go.
+void latencyBegin(LatencyChannel ch, uint8_t releaseInputs = 0);
+
+// sample the raw controls and arm the active channel on an edge.
+// Call right where a game reads its inputs.
+void latencyPoll();
+
+// a display update reflecting the pending input has just finished. Only
+// call it from draws that show the input's effect.
+void latencyFrame();
+
+// print the active channel's histogram over Serial and stop tracing
+void latencyEnd();
+#else
+inline void latencyBegin(LatencyChannel, uint8_t = 0) {}
+inline void latencyPoll() {}
+inline void latencyFrame() {}
+inline void latencyEnd() {}
+#endif
+
+#endif
@@ -1,4 +1,5 @@
 #include "minesweeper.h"
+#include "../latency/latency.h"
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7735.h>
 #include <SPI.h>
@@ -266,6 +267,7 @@ bool loopMinesweeper() {
     tft.drawRect(x, y, blockSize, blockSize, Outline_gray);
 
         // Read joystick
+    latencyPoll();
     int xVal = analogRead(JOY_X);
     int yVal = analogRead(JOY_Y);
     if (xVal < 400 && current_position[0] < 7) current_position[0]++;
@@ -273,7 +275,8 @@ bool loopMinesweeper() {
     else if (yVal < 400 && current_position[1] < 7) current_position[1]++;
     else if (yVal > 600 && current_position[1] > 0) current_position[1]--;
 
-    // Update current tile position
+    // Update current tile position; only a move or a reveal ends a latency sample
+    bool changed = x != current_position[0] * blockSize || y != current_position[1] * blockSize;
     x = current_position[0] * blockSize;
     y = current_position[1] * blockSize;
 
@@ -311,6 +314,7 @@ bool loopMinesweeper() {
           lose = true;
           delay(100);
           GameOver();
+          latencyFrame();
           return true;
         }
 
@@ -323,7 +327,7 @@ bool loopMinesweeper() {
             reveal_grid[current_position[0]][current_position[1]] = 1;   
             drawCenteredNumber(current_position[0], current_position[1], current_tile_value, 2);
           }
-
+          changed = true;
         }
       }
       wasPressed = false;
@@ -332,6 +336,7 @@ bool loopMinesweeper() {
 
     // Draw current selected square
     tft.drawRect(current_position[0] * blockSize, current_position[1] * blockSize, blockSize, blockSize, ST77XX_RED);
+    if (changed) latencyFrame();
   }
   
   delay(150);
@@ -6,23 +6,47 @@
 /^---------------------------------------------------------------------------*/
 /*Base class for game actors (ghosts and pac-man).*/
 #include "actor.h"
+#include "controller.h"
 
-objectInfo Actor::draw() { 
+objectInfo Actor::draw() const { 
     return obj;
 }
 
-void Actor::tpTo(float row, float col, int dir) {
+void Actor::tpTo(int16_t row, int16_t col, int dir) {
     obj.dir = dir;
-    obj.pos.x = col;
-    obj.pos.y = row;
+    obj.pos.x = col * SUBTILE;
+    obj.pos.y = row * SUBTILE;
 }
 
-bool Actor::isWhole(float f) {
-    // Check if the float is within 0.03 of a whole tile
-    return (fabs(f - round(f)) < 0.03);
+void Actor::setSpeed(int16_t spd) {
+    obj.speed = spd;
 }
 
-int Actor::near(float f) {
-    // Get the int of the input float
-    return int(round(f));
+bool Actor::isWhole(int16_t p) {
+    // speeds divide SUBTILE, so tile centres are hit exactly
+    return (p % SUBTILE == 0);
+}
+
+int Actor::near(int16_t p) {
+    // round to the closest tile
+    return (p + SUBTILE/2) / SUBTILE;
+}
+
+void Actor::moveForward() {
+    // move down path in current direction
+    switch (obj.dir)
+    {
+    case UP:
+        obj.pos.y -= obj.speed;
+        break;
+    case DOWN:
+        obj.pos.y += obj.speed;
+        break;
+    case LEFT:
+        obj.pos.x -= obj.speed;
+        break;
+    case RIGHT:
+        obj.pos.x += obj.speed;
+        break;
+    }
 }
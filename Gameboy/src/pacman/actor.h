@@ -7,13 +7,13 @@
 /*Base class for game actors (ghosts and pac-man).*/
 #ifndef actor_h
 #define actor_h
-#include <Arduino.h>
+#include "../platform.h"
 #include "coordinates.h"
 
 // pass this between objects in game for state comparisons
 struct objectInfo {
-  CoordinatesF pos;
-  float speed;
+  Coordinates pos; // in sub-tile units
+  int16_t speed;   // sub-tile units per frame (must divide SUBTILE)
   int dir;
 };
 
@@ -29,18 +29,24 @@ class Actor {
     void action(){};
 
     // pass object position (in tiles) for interrogation in-game
-    objectInfo draw();
+    objectInfo draw() const;
 
     // teleport to tile position in given direction
-    void tpTo(float row, float col, int dir);
+    void tpTo(int16_t row, int16_t col, int dir);
+
+    // change speed (sub-tile units per frame, must divide SUBTILE)
+    void setSpeed(int16_t spd);
 
   protected:
     objectInfo obj;
-    // check if actor is directly on a tile (within a margin of error)
-    bool isWhole(float f);
+    // check if a sub-tile coordinate is exactly on a tile
+    bool isWhole(int16_t p);
+
+    // get what tile a sub-tile coordinate is closest to
+    int near(int16_t p);
 
-    // get what tile value f is closest to
-    int near(float f);
+    // move one step (speed units) in the current direction
+    void moveForward();
 };
 
 #endif
\ No newline at end of file
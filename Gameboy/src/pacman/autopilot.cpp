@@ -0,0 +1,141 @@
+/*Computer player for Pac-Man (attract mode and unattended runs)*/
+#include "autopilot.h"
+#include "controller.h"
+#include "exitMask.h"
+
+#define AP_CELLS (Y_BOUND * X_BOUND)
+
+// queue entries hold the tile index in the low bits and the first step
+// taken from pac-man's tile above them
+#define AP_TILE_MASK 0x03FF
+#define AP_DIR_SHIFT 12
+
+static inline bool getBit(const uint8_t *bits, uint16_t i)
+{
+    return bits[i >> 3] & (1 << (i & 7));
+}
+
+static inline void setBit(uint8_t *bits, uint16_t i)
+{
+    bits[i >> 3] |= 1 << (i & 7);
+}
+
+// tiles pac-man has seen this decision; static so the search's stack
+// frame doesn't grow with the map capacity
+static uint8_t visited[(AP_CELLS + 7) / 8];
+
+// a ghost pac-man should keep away from: not blue, not in the house
+static inline bool dangerous(PacManCore &core, uint8_t i)
+{
+    return !core.inHouse[i] && core.ghosts[i].getCurrentMode() != Frightened;
+}
+
+// a dangerous ghost is on (row, col) or next to it
+static bool blocked(PacManCore &core, int16_t row, int16_t col)
+{
+    for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+        if (!dangerous(core, i)) continue;
+        int16_t dr = tileOf(core.ghosts[i].draw().pos.y) - row;
+        int16_t dc = tileOf(core.ghosts[i].draw().pos.x) - col;
+        if (abs(dr) + abs(dc) <= 1) return true;
+    }
+    return false;
+}
+
+// exit whose tile is farthest in a straight line from the nearest
+// dangerous ghost, preferring exits that aren't blocked
+static int backAway(PacManCore &core, int16_t row, int16_t col, uint8_t exits)
+{
+    int best = NEUTRAL;
+    int32_t bestScore = -1;
+    for (uint8_t d = 0; d < 4; d++) {
+        if (!(exits & (1 << d))) continue;
+        int16_t r = row + rowStep(d);
+        int16_t c = col + colStep(d);
+
+        int32_t nearest = 0x7FFF;
+        for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+            Ghost &g = core.ghosts[i];
+            if (!dangerous(core, i)) continue;
+            int32_t dr = tileOf(g.draw().pos.y) - r;
+            int32_t dc = tileOf(g.draw().pos.x) - c;
+            if (dr*dr + dc*dc < nearest) nearest = dr*dr + dc*dc;
+        }
+        if (nearest == 0x7FFF) return NEUTRAL; // nothing to run from
+
+        int32_t score = nearest;
+        if (!blocked(core, r, c)) score += 0x8000;
+        if (score > bestScore) {
+            bestScore = score;
+            best = d;
+        }
+    }
+    return best;
+}
+
+int autopilotDirection(PacManCore &core)
+{
+    Coordinates pos = core.pac.draw().pos;
+    if (pos.x % SUBTILE != 0 || pos.y % SUBTILE != 0) return NEUTRAL;
+    int16_t row = pos.y / SUBTILE;
+    int16_t col = pos.x / SUBTILE;
+
+    // a ghost's tile and its neighbours count as walls, unless it's blue
+    // or still in the house: mark them seen so the search never enters them
+    memset(visited, 0, sizeof visited);
+    for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+        if (!dangerous(core, i)) continue;
+        int16_t gr = tileOf(core.ghosts[i].draw().pos.y);
+        int16_t gc = tileOf(core.ghosts[i].draw().pos.x);
+        for (int8_t d = -1; d < 4; d++) {
+            int16_t r = gr + (d < 0 ? 0 : rowStep(d));
+            int16_t c = gc + (d < 0 ? 0 : colStep(d));
+            if (r >= 0 && r < Y_BOUND && c >= 0 && c < X_BOUND)
+                setBit(visited, r * X_BOUND + c);
+        }
+    }
+
+    // breadth-first search for the closest dot, remembering which way
+    // each path left pac-man's tile
+    uint16_t queue[BFS_QUEUE_SIZE];
+    uint8_t head = 0, count = 0;
+
+    uint8_t exits = core.map.exits(row, col);
+    setBit(visited, row * X_BOUND + col);
+    for (uint8_t d = 0; d < 4; d++) {
+        if (!(exits & (1 << d))) continue;
+        uint16_t n = (row + rowStep(d)) * X_BOUND + col + colStep(d);
+        if (getBit(visited, n)) continue;
+        setBit(visited, n);
+        queue[count++] = n | (d << AP_DIR_SHIFT);
+    }
+
+    for (uint8_t expanded = 0; count > 0 && expanded < AUTOPILOT_MAX_TILES;
+         expanded++) {
+        uint16_t entry = queue[head];
+        head = (head + 1) % BFS_QUEUE_SIZE;
+        count--;
+
+        uint16_t cell = entry & AP_TILE_MASK;
+        int16_t r = cell / X_BOUND;
+        int16_t c = cell % X_BOUND;
+        uint8_t tile = core.map.tileAt(r, c);
+        if (tile == MapData::dot || tile == MapData::powerPellet) {
+            return entry >> AP_DIR_SHIFT;
+        }
+
+        uint8_t next = core.map.exits(r, c);
+        for (uint8_t d = 0; d < 4 && count < BFS_QUEUE_SIZE; d++) {
+            if (!(next & (1 << d))) continue;
+            uint16_t n = (r + rowStep(d)) * X_BOUND + c + colStep(d);
+            if (getBit(visited, n)) continue;
+            setBit(visited, n);
+            queue[(head + count) % BFS_QUEUE_SIZE] =
+                n | (entry & ~AP_TILE_MASK);
+            count++;
+        }
+    }
+
+    // no safe dot within reach
+    return backAway(core, row, col, exits);
+}
@@ -0,0 +1,19 @@
+/*Computer player for Pac-Man (attract mode and unattended runs)*/
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+#include "../platform.h"
+#include "core.h"
+
+// most tiles the dot search looks at per decision
+#define AUTOPILOT_MAX_TILES 96
+
+// Direction to steer pac-man in, for use as step() input. Heads for the
+// nearest dot or pellet while treating tiles next to an unfrightened
+// ghost as walls; with no safe dot in reach it backs away from ghosts.
+// Only decides on tile centres (NEUTRAL elsewhere), so the search runs
+// at most once every few frames.
+// Runtime complexity: O(AUTOPILOT_MAX_TILES), about 150 bytes of stack
+// (the BFS queue) plus a static visited bitset of one bit per tile.
+int autopilotDirection(PacManCore &core);
+
+#endif
@@ -1,44 +0,0 @@
-/*---------------------------------------------------------------------------^/
- | Names: Dillon Allan and Amir Hansen                                       |
- | ID: 0000000 and 0000001                                                  |
- | CMPUT 275, Winter 2019                                                    | 
- | Final Project: Pac Man on Arduino                                         |
-/^---------------------------------------------------------------------------*/
-// default state of each tile in game map (24x24 for 128x128 ST7735)
-#ifndef CLEANMAP_H
-#define CLEANMAP_H
-#include <Arduino.h>
-#include "gameConfig.h"
-
-const uint8_t blankMap[][X_BOUND] = { 
-// 0 0 0 0 0 0 0 0 0 0 1 1 1 1 1 1 1 1 1 1 2 2 2 2
-// 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3
-  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, // 0 top row
-  {0,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,0}, // 1
-  {0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,0}, // 2
-  {0,2,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,2,0}, // 3
-  {0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0}, // 4
-  {0,1,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,1,0}, // 5
-  {0,1,1,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,1,1,0}, // 6
-  {0,0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,0,0}, // 7
-  {4,4,4,4,0,1,0,0,1,1,1,3,3,1,1,1,0,0,1,0,4,4,4,4}, // 8
-  {0,0,0,0,0,1,0,0,1,0,0,4,4,0,0,1,0,0,1,0,0,0,0,0}, // 9 top of ghost box
-  {0,1,1,1,1,1,1,1,1,0,4,4,4,4,0,1,1,1,1,1,1,1,1,0}, // 10
-  {0,1,0,0,0,1,0,0,1,0,4,4,4,4,0,1,0,0,1,0,0,0,1,0}, // 11 ghost box center
-  {0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0}, // 12
-  {0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0}, // 13 bottom of ghost box
-  {4,4,4,4,0,1,0,0,1,1,1,1,1,1,1,1,0,0,1,0,4,4,4,4}, // 14
-  {0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0}, // 15
-  {0,1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,0}, // 16
-  {0,1,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,0,1,0,0,0,1,0}, // 17
-  {0,2,1,1,0,1,1,1,1,1,1,3,3,1,1,1,1,1,1,0,1,1,2,0}, // 18
-  {0,0,0,1,0,1,0,0,1,0,0,0,0,0,0,1,0,0,1,0,1,0,0,0}, // 19
-  {0,1,1,1,1,1,0,0,1,1,1,0,0,1,1,1,0,0,1,1,1,1,1,0}, // 20
-  {0,1,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,1,0}, // 21
-  {0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0}, // 22
-  {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, // 23 bottom row
-// 0 0 0 0 0 0 0 0 0 0 1 1 1 1 1 1 1 1 1 1 2 2 2 2
-// 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3
-};
-
-#endif
@@ -28,20 +28,19 @@ int Controller::getDirection()
 
     if (magnitude > DEAD_ZONE)
     {
-        // Up 45 to 135
-        // Down -45 to -135
-        // Right -45 to 45
-        // Left <-135 or > 135
-        angle = atan2(-joyY,joyX)*(180.0/PI);
-        if (angle >= 45 && angle <= 135)
+        // Split the stick into 90 degree sectors around the diagonals
+        // by comparing components (no trig needed):
+        // Down 45 to 135, Up -45 to -135, Left -45 to 45, Right the rest
+        long up = -joyY;
+        if (up >= joyX && up >= -joyX)
         {
             return DOWN;
         }
-        else if (angle <= -45 && angle >= -135)
+        else if (-up >= joyX && -up >= -joyX)
         {
             return UP;
         }
-        else if (angle <= 45 && angle >= -45)
+        else if (joyX >= 0)
         {
             return LEFT;
         }
@@ -45,11 +45,8 @@ class Controller
     // joystick y position
     long joyY;
 
-    // sum of joyX^2 and joyY^2 (use for calculating joystick pitch)
+    // sum of joyX^2 and joyY^2 (compared against the dead zone)
     long magnitude;
-
-    // current joystick pitch in degrees
-    float angle;
 };
 
 #endif
\ No newline at end of file
@@ -7,31 +7,24 @@
 /*Coordinate types*/
 #ifndef coordinates_h
 #define coordinates_h
-#include <Arduino.h>
+#include "../platform.h"
+#include "gameConfig.h"
 
-/* A structure for storing integer x y coordinates */
+/* A structure for storing integer x y coordinates.
+   Actor positions use the same type in sub-tile units (see SUBTILE). */
 struct Coordinates
 {   
     int16_t x;
     int16_t y; 
-};
 
-/* A structure for storing floating-point x y coordinates */
-struct CoordinatesF {   
-   float x;
-   float y;
-   
-   // return true if coords are within a 0.04 margin of error
-   inline bool operator==(CoordinatesF a) {
-   if (fabs(a.x-x)<0.04 && fabs(a.y- y)<0.04)
-      return true;
-   else
-      return false;
-   }
+    // return true if coords are exactly equal
+    inline bool operator==(Coordinates a) const {
+        return a.x == x && a.y == y;
+    }
 
-   // check if coordinates overlap within a small margin
-   static bool touching(CoordinatesF a, CoordinatesF b) {
-      return (fabs(a.x-b.x) < 0.5 && fabs(a.y-b.y) < 0.5);
-   }
+    // check if sub-tile positions overlap by more than half a tile
+    static bool touching(Coordinates a, Coordinates b) {
+        return (abs(a.x - b.x) < SUBTILE/2 && abs(a.y - b.y) < SUBTILE/2);
+    }
 };
 #endif
\ No newline at end of file
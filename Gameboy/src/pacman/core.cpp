@@ -0,0 +1,227 @@
+/*Headless Pac-Man rules: game state and one step per frame*/
+#include "core.h"
+#include "controller.h"
+#include "exitMask.h"
+
+// ghosts are checked for release in this order, one per frame
+static const uint8_t releaseOrder[NUM_GHOSTS] = {Speedy, Bashful, Pokey, Shadow};
+
+/* static */ CoreConfig CoreConfig::defaults()
+{
+    CoreConfig c;
+    c.pacSpeed = SUBTILE / 5;
+    c.ghostSpeed[Shadow] = SUBTILE / 10;
+    c.ghostSpeed[Speedy] = SUBTILE / 8;
+    c.ghostSpeed[Bashful] = SUBTILE / 8;
+    c.ghostSpeed[Pokey] = SUBTILE / 8;
+    c.powerTicks = 6000 / FRAME_DELAY;
+    c.deathTicks = Game::deathDelay / FRAME_DELAY;
+
+    // arcade level 1 schedule, in milliseconds
+    static const uint16_t phaseMs[MODE_PHASES] =
+        {7000, 20000, 7000, 20000, 5000, 20000, 5000};
+    for (uint8_t i = 0; i < MODE_PHASES; i++)
+        c.modePhases[i] = phaseMs[i] / FRAME_DELAY;
+
+    // red is out straight away, the rest after enough points
+    c.releaseScore[Shadow] = -1;
+    c.releaseScore[Speedy] = 20;
+    c.releaseScore[Bashful] = 35;
+    c.releaseScore[Pokey] = 50;
+    c.respawnTicks = 3000 / FRAME_DELAY;
+    c.lives = 3;
+    return c;
+}
+
+void PacManCore::reset(const CoreConfig &c)
+{
+    cfg = c;
+    game = Game(cfg.lives);
+    game.scoreChanged = game.livesChanged = false;
+
+    pac = PacMan();
+    pac.setSpeed(cfg.pacSpeed);
+    pac.powerDuration = cfg.powerTicks;
+    for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+        ghosts[i] = Ghost(0, 0, cfg.ghostSpeed[i], LEFT, i, 0, 0);
+    }
+
+    tick = 0;
+    deathTicksLeft = 0;
+    startLevel(0);
+}
+
+void PacManCore::startLevel(uint8_t index)
+{
+    // the pack is checked when it's built, so this only fails if the
+    // pack and the build's map size disagree
+    if (!loadLevel(index, map, layout, tileDecoded)) {
+        game.winGame();
+        return;
+    }
+    level = index;
+    levelStartScore = game.getScore();
+    levelChanged = true;
+    pacField.invalidate();
+
+    pac.powerful = 0;
+    pac.powerTicksLeft = 0;
+    modePhase = 0;
+    modeTicksLeft = cfg.modePhases[0];
+    for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+        ghosts[i].setCurrentMode(Scatter);
+    }
+
+    // scatter corners sit just outside the maze like the arcade's, so
+    // ghosts circle the nearest block instead of parking
+    ghosts[Shadow].setHomeTile(-2, map.cols - 3);
+    ghosts[Speedy].setHomeTile(-2, 2);
+    ghosts[Bashful].setHomeTile(map.rows + 1, map.cols - 1);
+    ghosts[Pokey].setHomeTile(map.rows + 1, 0);
+    goHome();
+}
+
+void PacManCore::step(int input)
+{
+    tick++;
+    if (game.isGameOver()) return;
+
+    // everything freezes for a moment after pac-man is caught
+    if (deathTicksLeft > 0) {
+        if (--deathTicksLeft == 0) {
+            goHome();
+            game.loseLife();
+            game.livesChanged = true;
+        }
+        return;
+    }
+
+    pac.action(input, map, game);
+
+    // maze cleared: on to the next one, or the game is won
+    if (map.pickupsLeft == 0) {
+        if (level + 1 < levelCount()) startLevel(level + 1);
+        else game.winGame();
+        return;
+    }
+
+    updateModeSchedule();
+    // one flood fill per pac-man tile change serves every ghost. Only
+    // frightened ghosts read it, so it's left alone until fright starts.
+    bool fleeing = pac.powerful == 1;
+    for (uint8_t i = 0; i < NUM_GHOSTS && !fleeing; i++) {
+        fleeing = ghosts[i].getCurrentMode() == Frightened;
+    }
+    if (fleeing) {
+        pacField.update(map, tileOf(pac.draw().pos.y), tileOf(pac.draw().pos.x));
+    }
+    for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+        runGhost(i);
+    }
+
+    // compare ghost states to pac-man
+    for (int8_t i = NUM_GHOSTS - 1; i >= 0; i--) {
+        checkGhost(i);
+    }
+
+    releaseGhosts();
+}
+
+int PacManCore::scheduledMode()
+{
+    return (modePhase < MODE_PHASES && modePhase % 2 == 0) ? Scatter : Chase;
+}
+
+void PacManCore::goHome()
+{
+    pac.tpTo(layout.pacRow, layout.pacCol, LEFT);
+
+    // red starts outside the door, the rest wait in the house
+    ghosts[Shadow].tpTo(layout.exitRow(), layout.exitCol(), LEFT);
+    inHouse[Shadow] = false;
+    for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+        if (i != Shadow) sendToHouse(i, 0);
+    }
+}
+
+void PacManCore::sendToHouse(uint8_t i, uint16_t wait)
+{
+    // middle row of the house: pink in the centre, blue left, orange right
+    int16_t row = (layout.houseTop + layout.houseBottom) / 2;
+    int16_t col = (layout.houseLeft + layout.houseRight) / 2;
+    if (i == Bashful) col = layout.houseLeft;
+    if (i == Pokey) col = layout.houseRight;
+    ghosts[i].tpTo(row, col, UP);
+    inHouse[i] = true;
+    houseTicks[i] = wait;
+}
+
+void PacManCore::updateModeSchedule()
+{
+    // the clock stops while ghosts are frightened
+    if (pac.powerful != 0 || modePhase >= MODE_PHASES) return;
+
+    if (modeTicksLeft > 0) {
+        modeTicksLeft--;
+    }
+    else if (++modePhase < MODE_PHASES) {
+        modeTicksLeft = cfg.modePhases[modePhase];
+    }
+}
+
+// update ghost based on pac-man's current state
+void PacManCore::runGhost(uint8_t i)
+{
+    Ghost &g = ghosts[i];
+    if (pac.powerful == 1) {
+        g.setCurrentMode(Frightened);
+    }
+    else if (pac.powerful == 0 && g.getCurrentMode() != scheduledMode()) {
+        g.setCurrentMode(scheduledMode());
+    }
+
+    // ghosts in the house sit still until they're let out
+    if (inHouse[i]) {
+        if (houseTicks[i] > 0) houseTicks[i]--;
+        return;
+    }
+    g.action(pac, ghosts[Shadow], map, pacField);
+}
+
+// check ghost state against pac-man's state
+void PacManCore::checkGhost(uint8_t i)
+{
+    Ghost &g = ghosts[i];
+
+    // pac-man and ghost are in a fight to the death,
+    // and only one can survive...
+    if (deathTicksLeft > 0 || inHouse[i] ||
+        !Coordinates::touching(pac.draw().pos, g.draw().pos)) return;
+
+    // ghost kills pac-man :(
+    // (the life is taken once the freeze is over)
+    if (g.getCurrentMode() != Frightened) {
+        deathTicksLeft = cfg.deathTicks > 0 ? cfg.deathTicks : 1;
+    }
+
+    // pac-man kills ghost :)
+    // send ghost home for a time out.
+    else {
+        sendToHouse(i, cfg.respawnTicks);
+        g.setCurrentMode(scheduledMode());
+    }
+}
+
+// let ghosts waiting in the house out once the score allows
+void PacManCore::releaseGhosts()
+{
+    int16_t points = game.getScore() - levelStartScore;
+    for (uint8_t i = 0; i < NUM_GHOSTS; i++) {
+        uint8_t g = releaseOrder[i];
+        if (inHouse[g] && houseTicks[g] == 0 && points > cfg.releaseScore[g]) {
+            ghosts[g].tpTo(layout.exitRow(), layout.exitCol(), LEFT);
+            inHouse[g] = false;
+            return;
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*Headless Pac-Man rules: game state and one step per frame*/
+#ifndef CORE_H
+#define CORE_H
+#include "../platform.h"
+#include "gameConfig.h"
+#include "mapData.h"
+#include "game.h"
+#include "pacMan.h"
+#include "ghost.h"
+#include "distanceField.h"
+#include "level.h"
+
+#define NUM_GHOSTS 4
+
+// Scatter/Chase phases before the ghosts chase for good
+#define MODE_PHASES 7
+
+// Tunable rules. Times are in frames (one step() each), speeds in
+// sub-tile units per frame and must divide SUBTILE.
+struct CoreConfig {
+    int16_t pacSpeed;
+    int16_t ghostSpeed[NUM_GHOSTS];   // indexed by personality
+    uint16_t powerTicks;              // how long a power pellet lasts
+    uint16_t deathTicks;              // freeze after pac-man is caught
+    uint16_t modePhases[MODE_PHASES]; // even phases scatter, odd chase
+    int16_t releaseScore[NUM_GHOSTS]; // points this level that let a ghost out
+    uint16_t respawnTicks;            // wait in the house after being eaten
+    int16_t lives;
+
+    // the console's rules at FRAME_DELAY per frame
+    static CoreConfig defaults();
+};
+
+// Everything that makes up a game of Pac-Man. Nothing here touches the
+// display, pins or the clock, so the same rules run on the console (one
+// step per frame) and in host tools (as fast as the CPU allows).
+struct PacManCore {
+    CoreConfig cfg;
+
+    MapData map;
+    LevelLayout layout; // spawn points and ghost house of the current level
+    Game game;
+    PacMan pac;
+    Ghost ghosts[NUM_GHOSTS]; // indexed by personality (red first)
+
+    // distance to pac-man, shared by all ghosts
+    DistanceField pacField;
+
+    uint32_t tick;           // frames since reset()
+    uint8_t modePhase;       // index into cfg.modePhases
+    uint16_t modeTicksLeft;  // frames left in the current phase
+    uint16_t deathTicksLeft; // non-zero while pac-man is caught
+
+    uint8_t level;           // index into the level pack
+    int16_t levelStartScore; // score when the level began
+    bool levelChanged;       // raised when a new maze has been loaded
+
+    // ghosts waiting in the house, and frames until each may leave
+    bool inHouse[NUM_GHOSTS];
+    uint16_t houseTicks[NUM_GHOSTS];
+
+    // if set, called for every tile as a level is decoded so the
+    // renderer can draw the maze in the same pass (kept across reset())
+    void (*tileDecoded)(int16_t row, int16_t col) = 0;
+
+    // start a new game with the given rules
+    void reset(const CoreConfig &c);
+
+    // advance one frame with the player steering towards input
+    // (a direction, or NEUTRAL to keep going)
+    void step(int input);
+
+    // mode the Scatter/Chase schedule currently asks for
+    int scheduledMode();
+
+    // teleport everyone to their starting tiles
+    void goHome();
+
+  private:
+    void startLevel(uint8_t index);
+    void sendToHouse(uint8_t i, uint16_t wait);
+    void updateModeSchedule();
+    void runGhost(uint8_t i);
+    void checkGhost(uint8_t i);
+    void releaseGhosts();
+};
+
+#endif
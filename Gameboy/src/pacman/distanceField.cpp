@@ -0,0 +1,82 @@
+/*Shared distance field from Pac-Man for ghost movement*/
+#include "distanceField.h"
+#include "exitMask.h"
+
+static inline void setCell(uint8_t *cells, uint16_t i, uint8_t v)
+{
+    uint8_t shift = 2 * (i & 3);
+    cells[i >> 2] = (cells[i >> 2] & ~(3 << shift)) | (v << shift);
+}
+
+static inline uint8_t getCell(const uint8_t *cells, uint16_t i)
+{
+    return (cells[i >> 2] >> (2 * (i & 3))) & 3;
+}
+
+void DistanceField::update(const MapData &map, int16_t row, int16_t col)
+{
+    if (row == originRow && col == originCol) return;
+    if (row < 0 || row >= Y_BOUND || col < 0 || col >= X_BOUND) return;
+    originRow = row;
+    originCol = col;
+
+    // every tile starts unreached, which doubles as the visited flag
+    memset(cells, 0xFF, sizeof cells);
+
+    // reverse BFS from pac-man over a fixed ring buffer of tile indices
+    uint16_t queue[BFS_QUEUE_SIZE];
+    uint8_t head = 0, count = 1;
+    queue[0] = row * X_BOUND + col;
+    setCell(cells, queue[0], 0);
+
+    while (count > 0) {
+        uint16_t cell = queue[head];
+        head = (head + 1) % BFS_QUEUE_SIZE;
+        count--;
+
+        uint8_t next = (getCell(cells, cell) + 1) % 3;
+        int r = cell / X_BOUND;
+        int c = cell % X_BOUND;
+        uint8_t exits = map.exits(r, c);
+        for (uint8_t d = 0; d < 4; d++) {
+            if (!(exits & (1 << d))) continue;
+            int nr = r + rowStep(d);
+            int nc = c + colStep(d);
+            uint16_t n = nr * X_BOUND + nc;
+            if (getCell(cells, n) != DF_UNREACHED) continue;
+            if (count == BFS_QUEUE_SIZE) {
+                // can't finish the flood; leave the field invalid
+                invalidate();
+                memset(cells, 0xFF, sizeof cells);
+                return;
+            }
+            setCell(cells, n, next);
+            queue[(head + count) % BFS_QUEUE_SIZE] = n;
+            count++;
+        }
+    }
+}
+
+uint8_t DistanceField::at(int16_t row, int16_t col)
+{
+    if (originRow < 0 || row < 0 || row >= Y_BOUND || col < 0 || col >= X_BOUND)
+        return DF_UNREACHED;
+    return getCell(cells, row * X_BOUND + col);
+}
+
+uint8_t DistanceField::away(int16_t row, int16_t col, uint8_t exits)
+{
+    uint8_t here = at(row, col);
+    if (here == DF_UNREACHED) return 0;
+
+    // a neighbour one step farther has residue (here + 1) mod 3
+    uint8_t farther = (here + 1) % 3;
+    uint8_t mask = 0;
+    for (uint8_t d = 0; d < 4; d++) {
+        if ((exits & (1 << d)) &&
+            at(row + rowStep(d), col + colStep(d)) == farther) {
+            mask |= 1 << d;
+        }
+    }
+    return mask;
+}
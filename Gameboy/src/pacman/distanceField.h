@@ -0,0 +1,41 @@
+/*Shared distance field from Pac-Man for ghost movement*/
+#ifndef DISTANCEFIELD_H
+#define DISTANCEFIELD_H
+#include "../platform.h"
+#include "gameConfig.h"
+#include "mapData.h"
+
+#define DF_UNREACHED 3
+
+// Walking distance from every tile to Pac-Man's tile, stored modulo 3 in
+// 2 bits per tile (DF_UNREACHED for walls). Neighbouring tiles always
+// differ by exactly one step, so the residue is enough to tell whether a
+// neighbour is closer to or farther from Pac-Man.
+//
+// One flood fill per Pac-Man tile change is shared by every ghost, no
+// matter how many there are. Only frightened ghosts read it (to flee), so
+// it's only kept up to date while there are any.
+struct DistanceField {
+    uint8_t cells[(Y_BOUND * X_BOUND + 3) / 4];
+
+    // tile the field was last computed from, -1 when invalid
+    int16_t originRow = -1;
+    int16_t originCol = -1;
+
+    // recompute over map's walkable tiles from (row, col) unless that's
+    // already the origin
+    void update(const MapData &map, int16_t row, int16_t col);
+
+    // force a recompute on the next update()
+    void invalidate() { originRow = originCol = -1; }
+
+    // distance to the origin mod 3, or DF_UNREACHED
+    uint8_t at(int16_t row, int16_t col);
+
+    // the directions in exits (bit d for direction d) that take (row, col)
+    // one step farther from the origin. 0 if the tile isn't in the field.
+    // Runtime complexity: O(1)
+    uint8_t away(int16_t row, int16_t col, uint8_t exits);
+};
+
+#endif
@@ -0,0 +1,48 @@
+/*Helpers for tile exit masks*/
+#ifndef EXITMASK_H
+#define EXITMASK_H
+#include "../platform.h"
+#include "gameConfig.h"
+
+// Bit d of a tile's exit mask is set when moving in direction d
+// (UP, RIGHT, LEFT, DOWN) from that tile leads onto a walkable tile.
+// host/pack_levels.cpp stores one per tile with each level, and
+// MapData::exits() reads it straight from flash.
+
+// number of exits in a mask
+inline uint8_t countExits(uint8_t mask)
+{
+    return (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1);
+}
+
+// check if a mask allows moving in direction dir
+inline bool hasExit(uint8_t mask, int dir)
+{
+    return dir >= 0 && dir < 4 && (mask & (1 << dir));
+}
+
+// direction that reverses dir (UP <-> DOWN, LEFT <-> RIGHT)
+inline int reverseDir(int dir)
+{
+    return 3 - dir;
+}
+
+// tile offsets for one step in direction dir (UP, RIGHT, LEFT, DOWN);
+// 0 for anything else
+inline int8_t rowStep(int dir)
+{
+    return (dir == 3) - (dir == 0);
+}
+
+inline int8_t colStep(int dir)
+{
+    return (dir == 1) - (dir == 2);
+}
+
+// tile a sub-tile coordinate is closest to
+inline int16_t tileOf(int16_t p)
+{
+    return (p + SUBTILE/2) / SUBTILE;
+}
+
+#endif
@@ -39,7 +39,15 @@ void Game::resumeGame() {
     paused = false;
 }
 
+void Game::winGame() {
+    won = true;
+}
+
+bool Game::hasWon() {
+    return won;
+}
+
 bool Game::isGameOver() {
-    if (lives < 1 || score == Game::maxScore) return true;
+    if (lives < 1 || won) return true;
     return false;
 }
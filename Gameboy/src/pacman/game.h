@@ -7,7 +7,7 @@
 /*Track state of game*/
 #ifndef game_h
 #define game_h
-#include <Arduino.h>
+#include "../platform.h"
 
 // Game state stored in instance of Game
 class Game {
@@ -16,9 +16,15 @@ class Game {
         Game(int16_t lives = 3);
         ~Game() {};
 
-        // check if out of lives or at max score
+        // check if out of lives or every level is cleared
         bool isGameOver();
 
+        // end the game as a win (last level cleared)
+        void winGame();
+
+        // check if the game ended in a win
+        bool hasWon();
+
         // gets value of lives member
         int16_t getRemainingLives();
         
@@ -46,9 +52,6 @@ class Game {
         bool livesChanged;
 
         static const int16_t deathDelay = 2000; // in milliseconds
-
-        // get this score to win the game
-        static const int16_t maxScore = 256;
     
     private:
         int16_t score = 0; // game score
@@ -56,6 +59,7 @@ class Game {
         
         int16_t lives;     // player lives
         bool paused = false; // if true, then game should stop running
+        bool won = false;    // every level has been cleared
 
 };
 
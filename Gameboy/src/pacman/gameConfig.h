@@ -13,10 +13,34 @@
 #define FONT_HEIGHT 8*FONT_SIZE // in pixels (now 8 instead of 16)
 
 // CRITICAL CHANGES FOR 128x128 DISPLAY:
-#define Y_BOUND 24     // CHANGED: Reduced from 31 (fewer tiles vertically)
-#define X_BOUND 24     // CHANGED: Reduced from 28 (fewer tiles horizontally)
 #define SCALE 4        // CHANGED: Reduced from 8 (smaller tiles)
 
+// Largest maze in tiles (the full arcade maze). Levels can be smaller;
+// the loaded size is in MapData::rows and MapData::cols. Per-tile state
+// is sized for this whatever level is loaded: 3 bits in MapData, 2 in
+// DistanceField and 1 for the autopilot, 652 bytes of SRAM at 31x28.
+#define Y_BOUND 31
+#define X_BOUND 28
+
+// maze rows on screen at once; taller mazes scroll to follow pac-man,
+// moving once he's within CAMERA_MARGIN rows of the top or bottom
+#define VIEW_ROWS 24
+#define CAMERA_MARGIN 5
+
+// Ring buffer capacity for flood fills over the maze. The frontier on
+// our mazes (arcade one included) never holds more than ~22 tiles, so
+// this leaves plenty of headroom.
+#define BFS_QUEUE_SIZE 64
+
+// Actor positions and speeds are integers in 1/SUBTILE of a tile.
+// Every speed must divide SUBTILE so actors land exactly on tile centres
+// (40 covers the 1/5, 1/8 and 1/10 tile-per-frame speeds we use).
+#define SUBTILE 40
+
+// frames without joystick input before the autopilot takes over
+// (attract mode); touching the stick hands control straight back
+#define ATTRACT_IDLE_FRAMES (20000 / FRAME_DELAY)
+
 // ST7735 Color Definitions (replacing ILI9341 colors)
 #define ST7735_PINK 0xFE19      // Pink color in RGB565
 #define ST7735_LIGHTBLUE 0x867D // Light blue color in RGB565
@@ -6,240 +6,191 @@
 /^---------------------------------------------------------------------------*/
 /*Track state of ghosts in Pac-Man*/
 #include "ghost.h"
-#include "global.h"
-#include "BFS.h"
+#include "controller.h"
+#include "exitMask.h"
+#include "nextHop.h"
 
 
-Ghost::Ghost(float row, float col, float spd,int dir,int err)
+Ghost::Ghost(int16_t row, int16_t col, int16_t spd, int dir, int persona,
+             int16_t homeRow, int16_t homeCol)
 {
-    obj.pos.x = col;
-    obj.pos.y = row;
+    obj.pos.x = col * SUBTILE;
+    obj.pos.y = row * SUBTILE;
     obj.speed = spd;
     obj.dir = dir;
-    errorChance = err;
+    this->persona = persona;
+    homeTile = {homeCol, homeRow};
 }
 
-void Ghost::action() {
+void Ghost::action(const PacMan &pac, const Ghost &red, const MapData &map,
+                   DistanceField &field)
+{
     // check if ghost is directly on a tile
     if(isWhole(obj.pos.x) && isWhole(obj.pos.y))
     {
         lastTile = currentTile;
         currentTile.x = near(obj.pos.x);
         currentTile.y = near(obj.pos.y);
+        uint8_t exits = map.exits(currentTile.y, currentTile.x);
         
         // ghost direction can change if at an intersection
-        if (atIntersection()) {
-            CoordinatesF pacPosF = pac.draw().pos;
-            // if no error, ghost should chase pac-man
-            if (random(0,1000)>errorChance && currentMode == Chase && 
-                !(near(pacPosF.x) == near(obj.pos.x) && 
-                near(pacPosF.y) == near(obj.pos.y) )) {
-                
-                // get next tile from pac-man's current position
-                // (row, col pair!)
-                setTargetTile({near(pacPosF.x), near(pacPosF.y)}); 
-                
-                // use BFS search to get next tile in min-path.
-                // BFS uses row col pairs, so swap x and y as needed
-                Coordinates nextTile = BFS({currentTile.y, currentTile.x}, 
-                    {targetTile.y, targetTile.x});
-                nextTile = {nextTile.y, nextTile.x};
-                
-                // set new direction for ghost (allowed to reverse direction)
-                if (nextTile.x > currentTile.x) {
-                    obj.dir = RIGHT;
-                }
-                else if (nextTile.x < currentTile.x) {
-                    obj.dir = LEFT;
-                }
-                else if (nextTile.y > currentTile.y) {
-                    obj.dir = DOWN;
-                }
-                else if (nextTile.y < currentTile.y) {
-                    obj.dir = UP;
-                }
+        if (atIntersection(exits)) {
+            if (currentMode == Frightened) {
+                // run from pac-man
+                fleePath(pac, exits, field);
             }
-            else if (currentMode == Frightened) {
-                // get a pseudorandom direction
-                randomPath();           
+            else if (currentMode == Chase && persona == Shadow) {
+                huntPath(pac, map, exits);
             }
-            // ghost should scatter
-            else
-            {
-                randomPath();   
+            else {
+                setTargetTile(currentMode == Chase ? chaseTarget(pac, red) : homeTile);
+                steerToTarget(exits);
             }
         }
         else {
             // no choice but to move forward
-            followPath(); 
+            followPath(exits); 
         }
     }
     moveForward(); // keep moving to next tile in current direction
 }
 
-void Ghost::randomPath()
+Coordinates Ghost::chaseTarget(const PacMan &pac, const Ghost &red)
 {
-    int row = near(obj.pos.y);
-    int col = near(obj.pos.x);
-    
-    // get random new direction
-    int ran = random(0,1000)%4;
-    switch (ran) {
-        case UP:
-            if (isValid(row - 1, col))
-            {
-                obj.dir = UP;
-            }
-            else if (isValid(row, col - 1))
-            {
-                obj.dir = LEFT;
-            }
-            else if (isValid(row + 1, col))
-            {
-                obj.dir = DOWN;
-            }
-            else if (isValid(row, col + 1))
-            {
-                obj.dir = RIGHT;
-            }
-
-            break;
-
-        case DOWN:
-            if (isValid(row + 1, col))
-            {
-                obj.dir = DOWN;
-            }
-            else if (isValid(row, col + 1))
-            {
-                obj.dir = RIGHT;
-            }
-            else if (isValid(row - 1, col))
-            {
-                obj.dir = UP;
-            }
-            else if (isValid(row, col - 1))
-            {
-                obj.dir = LEFT;
-            }
-
-            break;
+    objectInfo p = pac.draw();
+    int16_t pacCol = near(p.pos.x);
+    int16_t pacRow = near(p.pos.y);
+
+    switch (persona) {
+        case Speedy:
+            return {int16_t(pacCol + 4*colStep(p.dir)),
+                    int16_t(pacRow + 4*rowStep(p.dir))};
+
+        case Bashful: {
+            // double the vector from red to the tile two ahead of pac-man
+            int16_t pivotCol = pacCol + 2*colStep(p.dir);
+            int16_t pivotRow = pacRow + 2*rowStep(p.dir);
+            return {int16_t(2*pivotCol - red.currentTile.x),
+                    int16_t(2*pivotRow - red.currentTile.y)};
+        }
 
-        case LEFT:
-            if (isValid(row, col - 1))
-            {
-                obj.dir = LEFT;
-            }
-            else if (isValid(row + 1, col))
-            {
-                obj.dir = DOWN;
-            }
-            else if (isValid(row, col + 1))
-            {
-                obj.dir = RIGHT;
-            }
-            else if (isValid(row - 1, col))
-            {
-                obj.dir = UP;
-            }
-            
-            break;
+        case Pokey: {
+            // give up and head home once within 8 tiles of pac-man
+            int16_t dx = pacCol - currentTile.x;
+            int16_t dy = pacRow - currentTile.y;
+            if (dx*dx + dy*dy < 8*8) return homeTile;
+            return {pacCol, pacRow};
+        }
 
-        case RIGHT:
-            if (isValid(row, col + 1))
-            {
-                obj.dir = RIGHT;
-            }
-            else if (isValid(row - 1, col))
-            {
-                obj.dir = UP;
-            }
-            else if (isValid(row, col - 1))
-            {
-                obj.dir = LEFT;
-            }
-            else if (isValid(row + 1, col))
-            {
-                obj.dir = DOWN;
-            }
-            
-            break;
+        default: // Shadow
+            return {pacCol, pacRow};
     }
 }
 
-
-void Ghost::followPath()
+void Ghost::steerToTarget(uint8_t exits)
 {
-    // continue down path (not allowed to reverse direction)
-    int row = near(obj.pos.y);
-    int col = near(obj.pos.x);
-    if (obj.dir != UP && isValid(row + 1, col))
-    {
-        obj.dir = DOWN;
-    }
-    else if (obj.dir != DOWN && isValid(row - 1, col))
-    {
-        obj.dir = UP;
+    // ties go to the first of UP, LEFT, DOWN, RIGHT, as in the arcade
+    static const uint8_t preferred[4] = {UP, LEFT, DOWN, RIGHT};
+    exits &= ~(1 << reverseDir(obj.dir));
+
+    int32_t best = -1;
+    for (uint8_t i = 0; i < 4; i++) {
+        uint8_t d = preferred[i];
+        if (!(exits & (1 << d))) continue;
+        int32_t dx = currentTile.x + colStep(d) - targetTile.x;
+        int32_t dy = currentTile.y + rowStep(d) - targetTile.y;
+        int32_t dist = dx*dx + dy*dy;
+        if (best < 0 || dist < best) {
+            best = dist;
+            obj.dir = d;
+        }
     }
-    else if (obj.dir != LEFT && isValid(row, col + 1))
-    {
-        obj.dir = RIGHT;
+}
+
+void Ghost::huntPath(const PacMan &pac, const MapData &map, uint8_t exits)
+{
+    objectInfo p = pac.draw();
+    int16_t pacCol = near(p.pos.x);
+    int16_t pacRow = near(p.pos.y);
+
+    // follow the maze's shortest path, unless it starts back the way the
+    // ghost came; then steer in a straight line like the others
+    int dir = nextHopDirection(map, currentTile.y, currentTile.x, pacRow, pacCol);
+    if (dir != reverseDir(obj.dir) && hasExit(exits, dir)) {
+        obj.dir = dir;
+        return;
     }
-    else if (obj.dir != RIGHT && isValid(row, col - 1))
-    {
-        obj.dir = LEFT;
+    setTargetTile({pacCol, pacRow});
+    steerToTarget(exits);
+}
+
+void Ghost::fleePath(const PacMan &pac, uint8_t exits, DistanceField &field)
+{
+    objectInfo p = pac.draw();
+    int16_t pacCol = near(p.pos.x);
+    int16_t pacRow = near(p.pos.y);
+
+    exits &= ~(1 << reverseDir(obj.dir));
+
+    // Walking distance decides first: the shared field says which exits
+    // lead away from pac-man. If none do (or the ghost is off the field,
+    // e.g. leaving the box), every exit is a candidate.
+    uint8_t away = field.away(currentTile.y, currentTile.x, exits);
+    if (away) exits = away;
+
+    // among the candidates, end up farthest in a straight line
+    int32_t best = -1;
+    for (uint8_t d = 0; d < 4; d++) {
+        if (!(exits & (1 << d))) continue;
+        int32_t dx = currentTile.x + colStep(d) - pacCol;
+        int32_t dy = currentTile.y + rowStep(d) - pacRow;
+        int32_t dist = dx*dx + dy*dy;
+        if (dist > best) {
+            best = dist;
+            obj.dir = d;
+        }
     }
 }
 
 
-void Ghost::moveForward() {
-    // move down path in current direction
-    switch (obj.dir)
-    {
-    case UP:
-        obj.pos.y -= obj.speed;
-        break;
-    case DOWN:
-        obj.pos.y += obj.speed;
-        break;
-    case LEFT:
-        obj.pos.x -= obj.speed;
-        break;
-    case RIGHT:
-        obj.pos.x += obj.speed;
-        break;
+void Ghost::followPath(uint8_t exits)
+{
+    // continue down path (not allowed to reverse direction, unless it's
+    // a dead end)
+    static const uint8_t preferred[4] = {DOWN, UP, RIGHT, LEFT};
+    uint8_t ahead = exits & ~(1 << reverseDir(obj.dir));
+    for (uint8_t i = 0; i < 4; i++) {
+        if (ahead & (1 << preferred[i])) {
+            obj.dir = preferred[i];
+            return;
+        }
     }
+    if (hasExit(exits, reverseDir(obj.dir))) obj.dir = reverseDir(obj.dir);
 }
 
+
 bool Ghost::getFrightened() {
     return currentMode == Frightened;
 }
 
 void Ghost::setCurrentMode(int m) {
+    // leaving Frightened is the one change that doesn't reverse
+    if (m != currentMode && currentMode != Frightened) {
+        obj.dir = reverseDir(obj.dir);
+    }
     currentMode = m;
 }
 
-bool Ghost::isValid(int16_t row, int16_t col) {
-    // ASSUMPTION: inputs are not out of bounds of mapLayout!
-    int16_t tile = myMap.mapLayout[row][col];
-    return (tile != 0 && tile != 4);
-}
-
-bool Ghost::atIntersection() {
-    // check surrounding tiles (ghost cannot reverse direction )
-    int row = near(obj.pos.y);
-    int col = near(obj.pos.x);
-    int8_t turns = 0; // number of ways ghost can change direction
-    if (isValid(row-1, col)) turns++; // upper tile
-    if (isValid(row+1, col)) turns++; // lower tile
-    if (isValid(row, col-1)) turns++; // left tile
-    if (isValid(row, col+1)) turns++; // right tile
-
-    // ghost can always in at least one direction, so an intersection
-    // is when it has two or more options
-    return (turns > 2);
+bool Ghost::atIntersection(uint8_t exits) {
+    // ghost can always go back the way it came, so an intersection
+    // is when it has two or more other options
+    return countExits(exits) > 2;
 }
 
 void Ghost::setTargetTile(Coordinates pos) {
     targetTile = pos;
 }
+
+void Ghost::setHomeTile(int16_t row, int16_t col) {
+    homeTile = {col, row};
+}
@@ -10,6 +10,9 @@
 #include "actor.h"
 #include "coordinates.h"
 #include "gameConfig.h"
+#include "pacMan.h"
+#include "mapData.h"
+#include "distanceField.h"
 
 // movement modes for all ghosts
 enum mode {
@@ -18,35 +21,50 @@ enum mode {
     Frightened // flee from pac-man (and turn blue)
 };
 
+// how each ghost picks its chase target
+enum personality {
+    Shadow,  // red: pac-man's tile, by the shortest path
+    Speedy,  // pink: four tiles ahead of pac-man
+    Bashful, // blue: red's position mirrored through two tiles ahead of pac-man
+    Pokey    // orange: pac-man when far away, its home corner when close
+};
+
 // describe all ghosts with this class
 class Ghost : public Actor {
     public:
-        // initialize ghost with position, speed, direction, and error rate
-        Ghost(float row, float col, float spd, int dir,int err);
+        // initialize ghost with position, speed, direction, personality
+        // and scatter corner (row/col in tiles, spd in sub-tile units per
+        // frame). The corner may lie outside the map.
+        Ghost(int16_t row, int16_t col, int16_t spd, int dir, int persona,
+              int16_t homeRow, int16_t homeCol);
+        Ghost() {};
         ~Ghost() {};
 
-        // determine next state of ghost
-        virtual void action();
+        // determine next state of ghost. Chasing and fleeing look at
+        // pac-man, blue also needs red, and field must be current.
+        void action(const PacMan &pac, const Ghost &red, const MapData &map,
+                    DistanceField &field);
 
         // return value of panicked
         bool getFrightened();
 
-        // set value of currentMode member
+        // set value of currentMode member. Switching between Scatter and
+        // Chase, or becoming Frightened, makes the ghost turn around.
         void setCurrentMode(int m);
         int getCurrentMode() { return currentMode; }
 
-        // check if tile is valid for ghost movement
-        bool isValid(int16_t row, int16_t col);
-
         // checks if ghost needs to recalculate dir
         // (Rule: ghost cannot reverse direction unless changing mode.
         //  So, the ghost can only change direction if at an intersection.)
-        // Returns true if at intersection
-        bool atIntersection();
+        // Returns true if a tile with these exits is an intersection
+        bool atIntersection(uint8_t exits);
 
         // set target tile member
         void setTargetTile(Coordinates pos);
 
+        // move the scatter corner (row/col in tiles, may lie outside the map)
+        void setHomeTile(int16_t row, int16_t col);
+
         
         Coordinates lastTile; // previous position
         Coordinates currentTile; // current position
@@ -57,24 +75,30 @@ class Ghost : public Actor {
 
         // where to go in scatter mode
         Coordinates homeTile;
-        // value out of 1000 determines how often the ghost makes a 
-        // sub-optimal turn
-        int errorChance;
+
+        // which chase target rule this ghost follows
+        int persona;
 
         // determines movement style of ghost
-        // (chase is default)
-        int currentMode = Chase;
-        int rowNum[4] = {-1, 0, 0, 1}; 
-        int colNum[4] = {0, 1, -1, 0};
+        // (levels open with scatter)
+        int currentMode = Scatter;
 
-        // set ghost direction randomly
-        void randomPath();
+        // tile this ghost heads for in chase mode (x = col, y = row)
+        Coordinates chaseTarget(const PacMan &pac, const Ghost &red);
 
-        // set direction to continue down a path (no intersection exists)
-        void followPath();
+        // take the exit (never reversing) that leaves the ghost closest
+        // in a straight line to targetTile
+        void steerToTarget(uint8_t exits);
+
+        // red's chase: take the first step of the shortest path through
+        // the maze to pac-man's tile (nextHop.h), never reversing
+        void huntPath(const PacMan &pac, const MapData &map, uint8_t exits);
 
-        // move down the path in current direction
-        void moveForward();
+        // take the exit (never reversing) that leads farthest from pac-man
+        void fleePath(const PacMan &pac, uint8_t exits, DistanceField &field);
+
+        // set direction to continue down a path (no intersection exists)
+        void followPath(uint8_t exits);
 };
 
 #endif
\ No newline at end of file
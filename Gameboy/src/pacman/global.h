@@ -12,23 +12,25 @@
 #include <Adafruit_ST7735.h>
 #include <SPI.h>
 
-#include "mapData.h"
 #include "controller.h"
-#include "game.h"
-#include "pacMan.h"
-#include "ghost.h"
+#include "core.h"
 
-// globals for player controls, game map, and overall game state
+// player controls
 extern Controller con;
-extern MapData myMap;
-extern Game game; 
+
+// all game state (map, actors, score, ghost modes)
+extern PacManCore pacCore;
+
+// parts of pacCore, for the renderer
+extern MapData &myMap;
+extern Game &game;
 
 // game actors
-extern PacMan pac;
-extern Ghost red;
-extern Ghost pink;
-extern Ghost blue;
-extern Ghost orange;
+extern PacMan &pac;
+extern Ghost &red;
+extern Ghost &pink;
+extern Ghost &blue;
+extern Ghost &orange;
 
 extern Adafruit_ST7735 tft;
 
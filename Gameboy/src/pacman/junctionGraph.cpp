@@ -0,0 +1,164 @@
+/*Junction graph of the maze for ghost pathfinding*/
+#include "junctionGraph.h"
+#include "controller.h"
+#include "exitMask.h"
+
+// two-byte value in flash, low byte first
+static uint16_t read16(const uint8_t *p)
+{
+    return pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+}
+
+// packed tile index (row * cols + col) of node n
+static uint16_t nodeTile(const uint8_t *graph, uint8_t n)
+{
+    return read16(graph + 1 + 2 * n);
+}
+
+// node reached by leaving node n in direction dir, JG_NO_NODE if blocked;
+// the corridor's length in tiles is the byte after it
+static const uint8_t *edge(const uint8_t *graph, uint8_t n, uint8_t dir)
+{
+    uint8_t count = pgm_read_byte(graph);
+    return graph + 1 + 2 * count + 2 * (4 * n + dir);
+}
+
+// check whether a ghost may walk on the given tile
+static bool isOpen(const MapData &map, int16_t row, int16_t col)
+{
+    uint8_t tile = map.tileAt(row, col);
+    return tile != MapData::wall && tile != MapData::nonPlayArea;
+}
+
+// Leave (row, col) in direction dir and follow the corridor until the next
+// node. On return row/col hold that node and dir the last step taken.
+// Returns the number of tiles walked.
+static uint8_t walkCorridor(const MapData &map, int16_t &row, int16_t &col,
+                            uint8_t &dir)
+{
+    uint8_t steps = 0;
+    for (;;) {
+        row += rowStep(dir);
+        col += colStep(dir);
+        steps++;
+        uint8_t exits = map.exits(row, col);
+        if (countExits(exits) != 2 || steps == 255) return steps;
+        // two exits: keep going the way we didn't come from
+        exits &= ~(1 << reverseDir(dir));
+        dir = 0;
+        while (!(exits & (1 << dir))) dir++;
+    }
+}
+
+uint8_t junctionCount(const MapData &map)
+{
+    return map.junctions ? pgm_read_byte(map.junctions) : 0;
+}
+
+uint8_t junctionAt(const MapData &map, int16_t row, int16_t col)
+{
+    if (row < 0 || row >= map.rows || col < 0 || col >= map.cols) {
+        return JG_NO_NODE;
+    }
+
+    // nodes are stored in tile order
+    uint16_t tile = row * map.cols + col;
+    uint8_t lo = 0, hi = junctionCount(map);
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        uint16_t t = nodeTile(map.junctions, mid);
+        if (t == tile) return mid;
+        if (t < tile) lo = mid + 1;
+        else hi = mid;
+    }
+    return JG_NO_NODE;
+}
+
+int junctionRoute(const MapData &map, int16_t srcRow, int16_t srcCol,
+                  int16_t destRow, int16_t destCol)
+{
+    uint8_t src = junctionAt(map, srcRow, srcCol);
+    if (src == JG_NO_NODE || !isOpen(map, destRow, destCol) ||
+        (srcRow == destRow && srcCol == destCol)) {
+        return NEUTRAL;
+    }
+    const uint8_t *graph = map.junctions;
+    uint8_t count = pgm_read_byte(graph);
+
+    // The destination is either a node itself or sits in a corridor
+    // between two nodes. Record each end, how far it is from the
+    // destination and which way it leaves towards it.
+    uint8_t endNode[2], endSteps[2], endDir[2];
+    uint8_t ends = 0;
+    uint8_t destNode = junctionAt(map, destRow, destCol);
+    if (destNode != JG_NO_NODE) {
+        endNode[0] = destNode;
+        endSteps[0] = 0;
+        endDir[0] = NEUTRAL;
+        ends = 1;
+    }
+    else {
+        uint8_t exits = map.exits(destRow, destCol);
+        for (uint8_t d = 0; d < 4 && ends < 2; ++d) {
+            if (!(exits & (1 << d))) continue;
+            int16_t r = destRow, c = destCol;
+            uint8_t dir = d;
+            endSteps[ends] = walkCorridor(map, r, c, dir);
+            endNode[ends] = junctionAt(map, r, c);
+            endDir[ends] = reverseDir(dir);
+            if (endNode[ends] != JG_NO_NODE) ends++;
+        }
+    }
+
+    // Dijkstra over the nodes. first[] remembers which way to leave the
+    // source to get to each node.
+    uint16_t dist[JG_MAX_NODES];
+    uint8_t first[JG_MAX_NODES];
+    bool done[JG_MAX_NODES];
+    for (uint8_t n = 0; n < count; ++n) {
+        dist[n] = 0xFFFF;
+        done[n] = false;
+    }
+    dist[src] = 0;
+    first[src] = NEUTRAL;
+
+    for (;;) {
+        uint8_t u = JG_NO_NODE;
+        for (uint8_t n = 0; n < count; ++n) {
+            if (!done[n] && dist[n] != 0xFFFF &&
+                (u == JG_NO_NODE || dist[n] < dist[u])) u = n;
+        }
+        if (u == JG_NO_NODE) break;
+        done[u] = true;
+
+        // stop once every end of the destination corridor is settled
+        bool settled = true;
+        for (uint8_t e = 0; e < ends; ++e) settled = settled && done[endNode[e]];
+        if (settled) break;
+
+        for (uint8_t d = 0; d < 4; ++d) {
+            const uint8_t *way = edge(graph, u, d);
+            uint8_t v = pgm_read_byte(way);
+            if (v == JG_NO_NODE) continue;
+            uint16_t nd = dist[u] + pgm_read_byte(way + 1);
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                first[v] = (u == src) ? d : first[u];
+            }
+        }
+    }
+
+    int best = NEUTRAL;
+    uint16_t bestDist = 0xFFFF;
+    for (uint8_t e = 0; e < ends; ++e) {
+        uint8_t n = endNode[e];
+        if (dist[n] == 0xFFFF) continue;
+        uint16_t total = dist[n] + endSteps[e];
+        if (total < bestDist) {
+            bestDist = total;
+            // the destination corridor starts right at the source
+            best = (n == src) ? endDir[e] : first[n];
+        }
+    }
+    return best;
+}
@@ -0,0 +1,33 @@
+/*Junction graph of the maze for ghost pathfinding*/
+#ifndef JUNCTIONGRAPH_H
+#define JUNCTIONGRAPH_H
+#include "../platform.h"
+#include "mapData.h"
+
+// most junctions any maze in the pack can have
+#define JG_MAX_NODES 64
+#define JG_NO_NODE 0xFF
+
+// The maze compiled down to its decision points. Nodes are walkable tiles
+// with anything other than two exits (intersections); every exit of a
+// node is an edge running down a corridor to the next node. Corridor
+// tiles never need a decision, so searching here touches ~60 nodes
+// instead of ~300 tiles. host/pack_levels.cpp builds the graph with each
+// level and it's read straight from flash (format in level.h), so it
+// costs no SRAM.
+
+// number of nodes in the loaded level's graph
+uint8_t junctionCount(const MapData &map);
+
+// node index of a tile, JG_NO_NODE if the tile is not a node
+// Runtime complexity: O(log V) for V nodes
+uint8_t junctionAt(const MapData &map, int16_t row, int16_t col);
+
+// first direction of a shortest path from node tile (srcRow, srcCol)
+// to any walkable tile. Returns NEUTRAL if the source is not a node,
+// the destination can't be reached or both are the same tile.
+// Runtime complexity: O(V^2) for V nodes, about 260 bytes of stack
+int junctionRoute(const MapData &map, int16_t srcRow, int16_t srcCol,
+                  int16_t destRow, int16_t destCol);
+
+#endif
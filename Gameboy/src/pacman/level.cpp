@@ -0,0 +1,75 @@
+/*Pac-Man level pack: compressed mazes in flash and their loader*/
+#include "level.h"
+#include "levelData.h"
+
+uint8_t levelCount()
+{
+    return LEVEL_COUNT;
+}
+
+// write one decoded tile and let the renderer know
+static inline void putTile(MapData &map, int16_t r, int16_t c, uint8_t state,
+                           void (*tileDecoded)(int16_t, int16_t))
+{
+    map.setTile(r, c, state);
+    if (tileDecoded) tileDecoded(r, c);
+}
+
+bool loadLevel(uint8_t index, MapData &map, LevelLayout &layout,
+               void (*tileDecoded)(int16_t row, int16_t col))
+{
+    if (index >= LEVEL_COUNT) return false;
+    const uint8_t *p = levelData + pgm_read_word(&levelStart[index]);
+    uint8_t rows = pgm_read_byte(p++);
+    uint8_t cols = pgm_read_byte(p++);
+    if (rows > Y_BOUND || cols > X_BOUND) return false;
+    uint8_t half = (cols + 1) / 2;
+
+    map.resize(rows, cols);
+    layout.pacRow = pgm_read_byte(p++);
+    layout.pacCol = pgm_read_byte(p++);
+    layout.houseTop = -1;
+    layout.houseLeft = cols;
+    layout.dots = layout.pellets = 0;
+
+    for (int16_t r = 0; r < rows; r++) {
+        for (int16_t c = 0; c < half; ) {
+            uint8_t run = pgm_read_byte(p++);
+            uint8_t kind = run >> LEVEL_KIND_SHIFT;
+            uint8_t len = (run & (LEVEL_MAX_RUN - 1)) + 1;
+            if (c + len > half) return false;
+
+            // non-play runs away from the edge make up the ghost house
+            if (kind == MapData::nonPlayArea && c > 0) {
+                if (layout.houseTop < 0) {
+                    layout.houseTop = r;
+                    layout.doorCol = c;
+                    layout.doorWidth = cols - 2 * c;
+                }
+                layout.houseBottom = r;
+                if (c < layout.houseLeft) layout.houseLeft = c;
+            }
+
+            for (; len > 0; len--, c++) {
+                int16_t mirror = cols - 1 - c;
+                uint8_t copies = mirror == c ? 1 : 2;
+                if (kind == MapData::dot) layout.dots += copies;
+                if (kind == MapData::powerPellet) layout.pellets += copies;
+
+                putTile(map, r, c, kind, tileDecoded);
+                if (copies == 2) putTile(map, r, mirror, kind, tileDecoded);
+            }
+        }
+    }
+    layout.houseRight = cols - 1 - layout.houseLeft;
+    map.exitMasks = p;  // right after the runs
+
+    // routing data after the masks; a table is left out of big mazes
+    p += (rows * cols + 1) / 2;
+    map.junctions = p;
+    p += 1 + 10 * pgm_read_byte(p);
+    if (pgm_read_byte(p)) map.nextHops = p;
+
+    return layout.houseTop > 0 &&
+           map.tileAt(layout.pacRow, layout.pacCol) != MapData::wall;
+}
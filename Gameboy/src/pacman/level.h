@@ -0,0 +1,67 @@
+/*Pac-Man level pack: compressed mazes in flash and their loader*/
+#ifndef LEVEL_H
+#define LEVEL_H
+#include "../platform.h"
+#include "gameConfig.h"
+#include "mapData.h"
+
+// Mazes are left/right symmetric, so only the left half of each row is
+// stored ((cols + 1) / 2 tiles, the middle column of an odd width once).
+// A level is four bytes (rows, cols, pac-man's start row and column)
+// followed by the rows' left halves as runs: one byte per run, tile kind
+// (MapData::mapStates) in the top 3 bits and length - 1 in the low 5.
+// Runs never cross a row. The runs are followed by every tile's exit mask
+// (exitMask.h), two tiles per byte with the lower index in the low
+// nibble, indexed row * cols + col; the map reads them straight from
+// flash.
+//
+// Then comes the ghosts' routing data, also read from flash:
+// - the junction graph (junctionGraph.h): a node count, each node's tile
+//   index (row * cols + col, two bytes, low first) in tile order, and for
+//   each node and direction (UP, RIGHT, LEFT, DOWN) the node that way
+//   leads to (JG_NO_NODE if blocked) and the corridor's length in tiles
+// - the next-hop table (nextHop.h): bytes per table row, or 0 for a maze
+//   whose table would be over LEVEL_NEXT_HOP_BUDGET; if there is one, the
+//   number of walkable tiles before each row (two bytes, low first),
+//   then a row per node holding 2 bits per walkable tile in tile order
+//   (four per byte, the lowest first)
+//
+// host/pack_levels.cpp builds levelData.h from text mazes.
+
+#define LEVEL_KIND_SHIFT 5
+#define LEVEL_MAX_RUN (1 << LEVEL_KIND_SHIFT)
+
+// largest next-hop table a level carries; bigger mazes route over the
+// junction graph instead
+#define LEVEL_NEXT_HOP_BUDGET 2400
+
+// What the loader works out about a level while decoding it.
+// The ghost house is the non-play area that doesn't reach the left edge
+// (non-play runs from the edge just fill in beside the maze). Its top row
+// is the door, and ghosts leave through the tile just above the door's
+// left end.
+struct LevelLayout {
+    int16_t pacRow, pacCol;         // pac-man's start tile
+    int16_t houseTop, houseBottom;  // ghost house rows (inclusive)
+    int16_t houseLeft, houseRight;  // ghost house columns (inclusive)
+    int16_t doorCol, doorWidth;     // door on the house's top row
+    uint16_t dots, pellets;         // pickups in the maze
+
+    // tile in front of the door ghosts come out on
+    int16_t exitRow() const { return houseTop - 1; }
+    int16_t exitCol() const { return doorCol; }
+};
+
+// number of levels in the pack
+uint8_t levelCount();
+
+// Decode level index straight into map (every tile is overwritten) and
+// fill in layout. If given, tileDecoded is called for each tile as soon
+// as it's in map, so a renderer can draw the maze in the same pass.
+// Tiles arrive row by row starting with (0, 0); by then the map's size
+// and pac-man's start are already set.
+// Returns false for a missing or malformed level.
+bool loadLevel(uint8_t index, MapData &map, LevelLayout &layout,
+               void (*tileDecoded)(int16_t row, int16_t col) = 0);
+
+#endif
@@ -0,0 +1,627 @@
+/*Pac-Man mazes, generated by host/pack_levels.cpp - do not edit*/
+#ifndef LEVELDATA_H
+#define LEVELDATA_H
+#include "../platform.h"
+
+#define LEVEL_COUNT 3
+
+// where each level starts in levelData
+static const uint16_t levelStart[LEVEL_COUNT] PROGMEM = {0, 3155, 6179};
+
+static const uint8_t levelData[] PROGMEM = {
+  // 01_classic.txt
+  24, 24, 18, 11,
+  0x0B, 0x00, 0x29, 0x00, 0x00, 0x20, 0x02, 0x20, 0x03, 0x20, 0x00, 0x00,
+  0x40, 0x02, 0x20, 0x03, 0x20, 0x00, 0x00, 0x2A, 0x00, 0x20, 0x02, 0x20,
+  0x01, 0x20, 0x02, 0x00, 0x24, 0x01, 0x22, 0x00, 0x04, 0x20, 0x03, 0x20,
+  0x00, 0x83, 0x00, 0x20, 0x01, 0x22, 0x60, 0x04, 0x20, 0x01, 0x20, 0x01,
+  0x80, 0x00, 0x27, 0x00, 0x81, 0x00, 0x20, 0x02, 0x20, 0x01, 0x20, 0x00,
+  0x81, 0x00, 0x27, 0x02, 0x04, 0x20, 0x01, 0x20, 0x02, 0x83, 0x00, 0x20,
+  0x01, 0x23, 0x04, 0x20, 0x01, 0x20, 0x02, 0x00, 0x29, 0x00, 0x00, 0x20,
+  0x02, 0x20, 0x03, 0x20, 0x00, 0x00, 0x40, 0x21, 0x00, 0x25, 0x60, 0x02,
+  0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0x00, 0x24, 0x01, 0x22, 0x00, 0x00,
+  0x20, 0x07, 0x20, 0x00, 0x00, 0x2A, 0x0B,
+  // exit masks
+  0x80, 0x88, 0x88, 0x88, 0x88, 0x08, 0x80, 0x88, 0x88, 0x88, 0x88, 0x08,
+  0xA2, 0x66, 0xE6, 0x66, 0x66, 0x4C, 0xA2, 0x66, 0x66, 0x6E, 0x66, 0x4C,
+  0x92, 0x15, 0x93, 0x15, 0x31, 0x49, 0x92, 0x15, 0x31, 0x59, 0x31, 0x49,
+  0x92, 0x8C, 0x9A, 0x8C, 0xA8, 0xC9, 0x9A, 0x8C, 0xA8, 0xC9, 0xA8, 0x49,
+  0xB2, 0x66, 0xF6, 0x66, 0x6E, 0x67, 0x76, 0xE6, 0x66, 0x6F, 0x66, 0x4D,
+  0x92, 0x9D, 0x9B, 0x35, 0xD9, 0x19, 0x91, 0x9B, 0x35, 0xD9, 0xB9, 0x49,
+  0x32, 0x66, 0xD6, 0x24, 0x63, 0x4C, 0xA2, 0x56, 0x24, 0x6B, 0x66, 0x45,
+  0x10, 0x11, 0x93, 0x04, 0xB9, 0xC9, 0x9A, 0x9D, 0x20, 0x59, 0x11, 0x01,
+  0x00, 0x00, 0x92, 0x24, 0x6A, 0x67, 0x76, 0xC6, 0x24, 0x49, 0x00, 0x00,
+  0x80, 0x88, 0x9A, 0xAC, 0x59, 0x11, 0x11, 0x93, 0xAC, 0xC9, 0x88, 0x08,
+  0xA2, 0x66, 0xF6, 0x66, 0x4D, 0x00, 0x00, 0xB2, 0x66, 0x6F, 0x66, 0x4C,
+  0x92, 0x9D, 0x9B, 0xBD, 0x49, 0x00, 0x00, 0x92, 0xBD, 0xD9, 0xB9, 0x49,
+  0x32, 0x66, 0xF6, 0x66, 0x4D, 0x00, 0x00, 0xB2, 0x66, 0x6F, 0x66, 0x45,
+  0x10, 0x11, 0x93, 0x35, 0xC9, 0x88, 0x88, 0x9A, 0x35, 0x59, 0x11, 0x01,
+  0x00, 0x00, 0x92, 0x24, 0x6B, 0x66, 0x66, 0xD6, 0x24, 0x49, 0x00, 0x00,
+  0x80, 0x88, 0x9A, 0xAC, 0xD9, 0x19, 0x91, 0x9B, 0xAC, 0xC9, 0x88, 0x08,
+  0xA2, 0x66, 0xF6, 0x66, 0x67, 0x4C, 0xA2, 0x76, 0x66, 0x6F, 0x66, 0x4C,
+  0x92, 0x9D, 0x93, 0x9D, 0xB9, 0xC9, 0x9A, 0x9D, 0xB9, 0x59, 0xB9, 0x49,
+  0x32, 0xC6, 0xB6, 0x66, 0x6E, 0x67, 0x76, 0xE6, 0x66, 0x6D, 0x6A, 0x45,
+  0x90, 0x9B, 0x9E, 0x35, 0xD9, 0x19, 0x91, 0x9B, 0x35, 0xE9, 0xD9, 0x09,
+  0xA2, 0x76, 0x56, 0x24, 0x63, 0x4C, 0xA2, 0x56, 0x24, 0x63, 0x67, 0x4C,
+  0x92, 0x9D, 0x99, 0x88, 0xB9, 0xC9, 0x9A, 0x9D, 0x88, 0x99, 0xB9, 0x49,
+  0x32, 0x66, 0x66, 0x66, 0x66, 0x67, 0x76, 0x66, 0x66, 0x66, 0x66, 0x45,
+  0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01,
+  // junction graph, 38 nodes
+  0x26, 0x1D, 0x00, 0x2A, 0x00, 0x61, 0x00, 0x65, 0x00, 0x68, 0x00, 0x6A,
+  0x00, 0x6D, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x76, 0x00, 0x95, 0x00, 0xA2,
+  0x00, 0xCA, 0x00, 0xCD, 0x00, 0xF5, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x02,
+  0x01, 0x25, 0x01, 0x28, 0x01, 0x2F, 0x01, 0x32, 0x01, 0x58, 0x01, 0x5F,
+  0x01, 0x85, 0x01, 0x88, 0x01, 0x8F, 0x01, 0x92, 0x01, 0xB5, 0x01, 0xB8,
+  0x01, 0xBA, 0x01, 0xBD, 0x01, 0xBF, 0x01, 0xC2, 0x01, 0xE3, 0x01, 0xF4,
+  0x01, 0x1A, 0x02, 0x1D, 0x02, 0xFF, 0x00, 0x05, 0x08, 0x02, 0x07, 0x03,
+  0x03, 0xFF, 0x00, 0x09, 0x07, 0x06, 0x08, 0x08, 0x03, 0x00, 0x07, 0x03,
+  0x04, 0xFF, 0x00, 0x0A, 0x06, 0x00, 0x03, 0x04, 0x03, 0x02, 0x04, 0x0A,
+  0x02, 0xFF, 0x00, 0x05, 0x02, 0x03, 0x03, 0x0C, 0x06, 0x00, 0x08, 0x06,
+  0x03, 0x04, 0x02, 0xFF, 0x00, 0x01, 0x08, 0x07, 0x02, 0x05, 0x03, 0xFF,
+  0x00, 0xFF, 0x00, 0x08, 0x03, 0x06, 0x02, 0x0D, 0x06, 0x01, 0x03, 0x09,
+  0x04, 0x07, 0x03, 0x0B, 0x02, 0x01, 0x07, 0xFF, 0x00, 0x08, 0x04, 0x0B,
+  0x06, 0x03, 0x02, 0xFF, 0x00, 0x02, 0x06, 0x0E, 0x04, 0x08, 0x02, 0x09,
+  0x06, 0xFF, 0x00, 0x11, 0x04, 0x04, 0x06, 0x0D, 0x03, 0x0F, 0x04, 0xFF,
+  0x00, 0x07, 0x06, 0x10, 0x04, 0x0C, 0x03, 0xFF, 0x00, 0x0A, 0x04, 0x0F,
+  0x03, 0x12, 0x0A, 0x12, 0x02, 0x0C, 0x04, 0xFF, 0x00, 0x0E, 0x03, 0x13,
+  0x02, 0x0D, 0x04, 0x11, 0x03, 0xFF, 0x00, 0x14, 0x02, 0x0B, 0x04, 0x15,
+  0x0A, 0x10, 0x03, 0x15, 0x02, 0x0E, 0x02, 0x13, 0x03, 0x0E, 0x0A, 0x18,
+  0x04, 0x0F, 0x02, 0xFF, 0x00, 0x12, 0x03, 0x16, 0x02, 0x10, 0x02, 0x15,
+  0x03, 0xFF, 0x00, 0x17, 0x02, 0x11, 0x02, 0x11, 0x0A, 0x14, 0x03, 0x1B,
+  0x04, 0x13, 0x02, 0x17, 0x07, 0xFF, 0x00, 0x19, 0x02, 0x14, 0x02, 0xFF,
+  0x00, 0x16, 0x07, 0x1A, 0x02, 0x12, 0x04, 0x19, 0x03, 0x22, 0x0A, 0x1C,
+  0x02, 0x16, 0x02, 0x1E, 0x04, 0x18, 0x03, 0xFF, 0x00, 0x17, 0x02, 0x1B,
+  0x03, 0x1F, 0x04, 0xFF, 0x00, 0x15, 0x04, 0x23, 0x0A, 0x1A, 0x03, 0x21,
+  0x02, 0x18, 0x02, 0x1D, 0x03, 0xFF, 0x00, 0x22, 0x04, 0xFF, 0x00, 0x1E,
+  0x02, 0x1C, 0x03, 0x24, 0x06, 0x19, 0x04, 0x1F, 0x03, 0x1D, 0x02, 0xFF,
+  0x00, 0x1A, 0x04, 0x20, 0x02, 0x1E, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x21,
+  0x03, 0x1F, 0x02, 0x25, 0x06, 0x1B, 0x02, 0xFF, 0x00, 0x20, 0x03, 0x23,
+  0x04, 0x18, 0x0A, 0x1C, 0x04, 0x24, 0x0D, 0xFF, 0x00, 0x1B, 0x0A, 0x25,
+  0x0D, 0x21, 0x04, 0xFF, 0x00, 0x1D, 0x06, 0x25, 0x03, 0x22, 0x0D, 0xFF,
+  0x00, 0x20, 0x06, 0x23, 0x0D, 0x24, 0x03, 0xFF, 0x00,
+  // next-hop table
+  0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1A, 0x00, 0x20, 0x00, 0x36,
+  0x00, 0x3C, 0x00, 0x4C, 0x00, 0x50, 0x00, 0x5A, 0x00, 0x5E, 0x00, 0x6E,
+  0x00, 0x74, 0x00, 0x84, 0x00, 0x88, 0x00, 0x92, 0x00, 0x96, 0x00, 0xAA,
+  0x00, 0xB0, 0x00, 0xC4, 0x00, 0xCA, 0x00, 0xDA, 0x00, 0xDE, 0x00, 0xF4,
+  0x00, 0xAA, 0x54, 0x55, 0x55, 0x55, 0x5E, 0xE5, 0x55, 0xFE, 0xFF, 0x57,
+  0x55, 0x55, 0xE5, 0x57, 0xFE, 0xFF, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xF7,
+  0xF7, 0xFF, 0xFF, 0x57, 0xF5, 0x5F, 0xFF, 0xFF, 0x7F, 0x55, 0x7F, 0xFF,
+  0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xFF, 0x57, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0x57, 0xF5, 0xF7, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x7F, 0xAA, 0xAA, 0xAA, 0x2A, 0x55, 0xAA, 0xA7, 0x7A, 0xAA, 0xAA,
+  0xAA, 0xFE, 0xFF, 0xA7, 0x7E, 0xAA, 0xAA, 0xFF, 0x7F, 0xFE, 0xFE, 0xFF,
+  0xEF, 0xAF, 0xEA, 0xFF, 0xFF, 0xAF, 0xFF, 0xAA, 0xFE, 0xFF, 0xFF, 0xFE,
+  0xFE, 0xFF, 0xEF, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xAA, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xEA, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x50, 0x55, 0x55, 0x54, 0x45, 0x55, 0x54,
+  0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x52, 0x25, 0x55,
+  0xAA, 0x54, 0x55, 0x55, 0x55, 0xE5, 0x55, 0xFE, 0x57, 0x55, 0x55, 0x57,
+  0x57, 0x55, 0xF5, 0xF5, 0xFF, 0x5F, 0x55, 0xF5, 0x57, 0xFF, 0xFF, 0x55,
+  0x55, 0x5F, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0xF5, 0x5F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0x57, 0xF5, 0xF7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x5A, 0xA5,
+  0x55, 0xAA, 0x2A, 0x55, 0x55, 0x55, 0xA5, 0x57, 0xAA, 0xFE, 0x55, 0x55,
+  0x7E, 0xFE, 0xFF, 0xE7, 0xA7, 0xAA, 0xFE, 0x57, 0xA5, 0x5F, 0xAA, 0xEA,
+  0x7F, 0x55, 0x7E, 0xFE, 0xFF, 0xE7, 0xA7, 0xAA, 0xFE, 0xFF, 0x57, 0xA5,
+  0x5F, 0xAA, 0xAA, 0xFF, 0x5F, 0x55, 0xEA, 0xA5, 0xAA, 0xFA, 0x57, 0xA5,
+  0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x4A,
+  0xA5, 0x54, 0xAA, 0xAA, 0x52, 0x55, 0x55, 0xA5, 0x56, 0xAA, 0xAA, 0x55,
+  0x55, 0x5A, 0xAA, 0x5A, 0xA5, 0xA5, 0xAA, 0x5A, 0x55, 0xA5, 0x56, 0xAA,
+  0xAA, 0x55, 0x55, 0x5A, 0xAA, 0x5A, 0xA5, 0xA5, 0xAA, 0xAA, 0x55, 0x55,
+  0xA5, 0x56, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x6A, 0xA5, 0xAA, 0x5A, 0x55,
+  0xA5, 0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA, 0x0A, 0x00, 0x00,
+  0x2A, 0xA5, 0x52, 0xAA, 0xAA, 0xAA, 0x54, 0x55, 0xA5, 0x56, 0xAA, 0xAA,
+  0x55, 0x55, 0x5A, 0x56, 0x55, 0x65, 0xA5, 0xAA, 0x55, 0x55, 0xA5, 0x55,
+  0xAA, 0x5A, 0x55, 0x55, 0x56, 0x56, 0x55, 0x65, 0xA5, 0xAA, 0x55, 0x55,
+  0x55, 0xA5, 0x55, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0xAA, 0x5A,
+  0x55, 0xA5, 0xA5, 0x6A, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x56,
+  0x55, 0xAA, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0x4A, 0x55, 0xA5, 0x5E, 0xAA,
+  0xAA, 0x7F, 0x55, 0x7E, 0xFE, 0xFF, 0xE7, 0xA7, 0xEA, 0x7F, 0x55, 0xA5,
+  0x5F, 0xAA, 0xFE, 0x57, 0x55, 0x7E, 0xFE, 0xFF, 0xE7, 0xA7, 0xEA, 0xFF,
+  0x7F, 0x55, 0xA5, 0x5F, 0xAA, 0xFA, 0xFF, 0x55, 0x55, 0x7A, 0xA5, 0xEA,
+  0x5F, 0x55, 0x65, 0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x0A,
+  0x00, 0x00, 0xAA, 0xA4, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0x52, 0xA5, 0x7A,
+  0xAA, 0xAA, 0xEA, 0x7F, 0xEA, 0xAA, 0xAA, 0xAE, 0xAF, 0xAA, 0xFA, 0xFF,
+  0xAF, 0xFE, 0xAA, 0xAA, 0xFF, 0xFF, 0xFA, 0xFA, 0xFF, 0xAF, 0xAF, 0xAA,
+  0xAA, 0xFF, 0xFF, 0xAF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF,
+  0xEA, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+  0x0A, 0x00, 0x00, 0xAA, 0xA2, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2,
+  0xEA, 0xAA, 0xAA, 0xAA, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x03, 0x3F, 0x00, 0xF0, 0xF0, 0xFF,
+  0x0F, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x55, 0xC0, 0x00, 0xC0, 0x0F, 0x0F,
+  0x00, 0xF0, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
+  0x54, 0x55, 0x05, 0x54, 0x00, 0x00, 0x55, 0x55, 0x52, 0x2A, 0x55, 0xA5,
+  0xA5, 0xAA, 0x5A, 0x55, 0xA5, 0x56, 0xAA, 0xAA, 0x55, 0x55, 0x5A, 0xAA,
+  0x5A, 0xA5, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0x56, 0xAA, 0xAA, 0x6A,
+  0x55, 0x55, 0x6A, 0xA5, 0xAA, 0x5A, 0x55, 0xA5, 0xA5, 0xAA, 0xAA, 0x5A,
+  0x55, 0x55, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0xAA,
+  0x02, 0x00, 0x00, 0xA0, 0x02, 0xAA, 0xAA, 0x00, 0x00, 0x4A, 0xAA, 0x4A,
+  0xA5, 0xA5, 0xAA, 0x5A, 0x55, 0xA5, 0x56, 0xAA, 0xAA, 0x55, 0x55, 0x5A,
+  0x6A, 0x55, 0xA5, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0x56, 0xAA, 0x56,
+  0x55, 0x55, 0x55, 0x5A, 0xA5, 0x6A, 0x55, 0x55, 0x65, 0xA5, 0x5A, 0x55,
+  0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x50, 0x15, 0x00, 0x54, 0x54,
+  0x55, 0x45, 0xA5, 0x4A, 0x55, 0x55, 0xE5, 0x55, 0xFE, 0x7F, 0x55, 0x55,
+  0x57, 0x57, 0x55, 0x75, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0xF5, 0x55, 0xFF,
+  0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0x5F, 0x55, 0xF5, 0xF7, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00,
+  0xAA, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xAA, 0x02, 0x00, 0x00, 0x02,
+  0x02, 0x00, 0x20, 0xA0, 0xAA, 0x02, 0x00, 0xA0, 0x03, 0xAA, 0xFE, 0x00,
+  0x00, 0x3E, 0xFE, 0xFF, 0xE3, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF,
+  0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xEA, 0xFF, 0xFF, 0xEF, 0xAF,
+  0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x00, 0x40, 0x55,
+  0x40, 0x00, 0x00, 0x04, 0x04, 0x00, 0x40, 0x55, 0x05, 0x5C, 0x00, 0x00,
+  0x7F, 0x55, 0x7C, 0xFC, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xFF, 0x57, 0xF5,
+  0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0x57, 0xF5,
+  0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xA8, 0x0A,
+  0x00, 0x2A, 0xAA, 0xAA, 0xA2, 0xA2, 0xAA, 0xAA, 0x52, 0xA5, 0x7A, 0xAA,
+  0xAA, 0xFE, 0x7F, 0xEA, 0xAA, 0xAA, 0xAE, 0xAE, 0xAA, 0xAA, 0xEA, 0xFF,
+  0xAF, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xEA, 0xAF, 0xAA, 0xFA, 0xFF,
+  0xEF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x55,
+  0xAA, 0x54, 0x55, 0x55, 0x57, 0x57, 0x55, 0x75, 0xF5, 0xFF, 0x57, 0x55,
+  0x55, 0xF5, 0x55, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0x5F,
+  0x55, 0xF5, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+  0xFC, 0xAA, 0x2A, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xEF, 0xAF, 0xEA, 0xFF,
+  0xFF, 0xFF, 0xAF, 0xFF, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xEA,
+  0xFF, 0xFF, 0xEF, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF0, 0x53, 0xFF, 0xFF, 0x54, 0x55, 0x7F, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF,
+  0xFF, 0xFF, 0x57, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5,
+  0xFF, 0xFF, 0x57, 0xF5, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x4A, 0xAA, 0xAA, 0x2A, 0x55, 0xEA, 0xAA, 0xAA, 0xAE, 0xAE,
+  0xAA, 0xAA, 0xEA, 0xFF, 0xAF, 0xFA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xEA,
+  0xAF, 0xAA, 0xFA, 0xFF, 0xEF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x50, 0x00, 0x00, 0x40, 0x55, 0x40, 0x00, 0x00, 0x04, 0x05, 0x00,
+  0x50, 0x55, 0x05, 0x54, 0x00, 0x00, 0x55, 0x55, 0x50, 0x50, 0x55, 0xF5,
+  0xF5, 0xFF, 0xFF, 0x55, 0x55, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+  0xFF, 0xF5, 0xFF, 0xFF, 0x57, 0xF5, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x00, 0xAA, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0xA0, 0xA0,
+  0xAA, 0x0A, 0x00, 0xA0, 0x02, 0xAA, 0xAA, 0x00, 0x00, 0x0A, 0xAA, 0xAA,
+  0xA0, 0xAF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFA, 0xAF, 0xEA, 0xFF, 0xFF, 0xEF, 0xAF, 0xFE, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x55, 0x40, 0x00, 0x00, 0x04,
+  0x05, 0x00, 0x50, 0x55, 0x05, 0x54, 0x00, 0x00, 0x55, 0x55, 0x54, 0x54,
+  0x55, 0x45, 0xA5, 0x4A, 0x55, 0x55, 0x55, 0xE5, 0x55, 0xEA, 0xFF, 0x55,
+  0x55, 0x55, 0x7F, 0xF5, 0xFF, 0x5F, 0x55, 0xF5, 0xF7, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x02, 0x00, 0x20, 0xA0, 0xAA, 0x52, 0x05, 0x00, 0xA0, 0x15, 0xAA, 0x56,
+  0x55, 0x55, 0x15, 0x5A, 0xA5, 0x6A, 0x55, 0x55, 0x65, 0xA5, 0x5A, 0x55,
+  0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x04, 0x04, 0x00, 0xA0, 0x4A, 0x55, 0x85, 0x5A, 0xA8,
+  0xAA, 0xAA, 0x5A, 0x55, 0xAA, 0xA5, 0xAA, 0xAA, 0x56, 0xA5, 0xA6, 0xAA,
+  0xAA, 0xAA, 0x6A, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xAA, 0x02, 0x00, 0x00, 0x02,
+  0x02, 0x00, 0xA0, 0xA0, 0xAA, 0x0A, 0x00, 0xA0, 0x02, 0xAA, 0xAA, 0x00,
+  0x00, 0x2A, 0xAA, 0xAA, 0xA2, 0xA2, 0xAA, 0xAA, 0xAA, 0x52, 0xA5, 0x7A,
+  0xAA, 0xAA, 0xAA, 0xFF, 0x57, 0xEA, 0xAF, 0xAA, 0xFA, 0xFF, 0xEF, 0xEF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05,
+  0x55, 0x3C, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x7F, 0x55, 0x55, 0x75,
+  0xF5, 0x7F, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0xAA,
+  0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0xA5, 0x55, 0xAA, 0x56, 0x55,
+  0x55, 0x56, 0x56, 0x55, 0x65, 0xA5, 0xAA, 0x55, 0x55, 0xA5, 0x55, 0xAA,
+  0x5A, 0x55, 0x55, 0x56, 0x56, 0x55, 0x65, 0xA5, 0xAA, 0x55, 0x55, 0x55,
+  0xA5, 0x55, 0xAA, 0x4A, 0x55, 0x55, 0x55, 0x7A, 0xA5, 0xEA, 0x5F, 0x55,
+  0xE5, 0xA7, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x55, 0x55,
+  0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x00,
+  0x40, 0x55, 0x40, 0x00, 0x40, 0x05, 0x05, 0x00, 0x50, 0x55, 0x05, 0x54,
+  0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x40, 0x05, 0x05, 0x00, 0x00, 0x55,
+  0x55, 0x85, 0x54, 0xA8, 0xAA, 0x54, 0x55, 0x55, 0x6A, 0xA5, 0xAA, 0x5A,
+  0x55, 0xA5, 0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0x00,
+  0x00, 0x0A, 0xA0, 0x00, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xAA,
+  0x02, 0x00, 0x00, 0x02, 0x2A, 0x00, 0xA0, 0xA0, 0xAA, 0x0A, 0x00, 0xA0,
+  0x02, 0xAA, 0xAA, 0x00, 0x00, 0x0A, 0x2A, 0x00, 0xA0, 0xA0, 0xAA, 0xAA,
+  0x00, 0x00, 0xA0, 0x12, 0xAA, 0xAA, 0x2A, 0x55, 0x15, 0x6A, 0xA5, 0xAA,
+  0x5A, 0x55, 0xA5, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x6A, 0x55,
+  0x55, 0x55, 0x5A, 0xA5, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xA5, 0x56,
+  0xAA, 0xAA, 0x6A, 0x55, 0x6A, 0xAA, 0xAA, 0xA6, 0xA6, 0xAA, 0x6A, 0x55,
+  0xA5, 0x5A, 0xAA, 0xAA, 0x56, 0x55, 0x6A, 0xAA, 0xAA, 0xA6, 0xA6, 0xAA,
+  0xAA, 0x6A, 0x55, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0x52, 0x55, 0xEA, 0xA5,
+  0xAA, 0xFA, 0x57, 0xE5, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xA0, 0xA0,
+  0xAA, 0xAA, 0x00, 0x00, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x3C, 0xAA,
+  0xAF, 0xAA, 0xAA, 0xFE, 0xAF, 0xAE, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x05, 0x54, 0x55, 0x55, 0x55, 0x45, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55,
+  0x54, 0xA5, 0x54, 0x55, 0x55, 0x65, 0xA5, 0xAA, 0x6A, 0x55, 0x55, 0x55,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xA0, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA,
+  0x02, 0xAA, 0xA2, 0xAA, 0xA6, 0x2A, 0x65, 0x56, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
+  0x54, 0x55, 0x05, 0x50, 0x00, 0x00, 0x40, 0x55, 0x40, 0x00, 0x00, 0x04,
+  0x04, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00,
+  0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00,
+  0x55, 0x55, 0x40, 0xA5, 0x00, 0x50, 0x55, 0x25, 0xA5, 0xAA, 0x2A, 0x55,
+  0x55, 0x55, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0xAA,
+  0x02, 0x00, 0x00, 0xA0, 0x00, 0xAA, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00,
+  0x20, 0xA0, 0xAA, 0x00, 0x00, 0xA0, 0x00, 0xAA, 0x0A, 0x00, 0x00, 0x02,
+  0x02, 0x00, 0x20, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xAA, 0xAA,
+  0x00, 0x00, 0x00, 0x2A, 0xA0, 0xAA, 0x0A, 0x00, 0xA5, 0xA4, 0xAA, 0xAA,
+  0x4A, 0x55, 0x55,
+  // 02_crossroads.txt
+  24, 24, 18, 11,
+  0x0B, 0x00, 0x40, 0x28, 0x00, 0x00, 0x20, 0x02, 0x20, 0x03, 0x20, 0x00,
+  0x00, 0x20, 0x02, 0x20, 0x03, 0x20, 0x00, 0x00, 0x2A, 0x04, 0x20, 0x01,
+  0x20, 0x02, 0x04, 0x20, 0x01, 0x20, 0x02, 0x00, 0x24, 0x01, 0x20, 0x02,
+  0x00, 0x20, 0x02, 0x20, 0x01, 0x21, 0x61, 0x00, 0x20, 0x02, 0x20, 0x01,
+  0x20, 0x01, 0x80, 0x00, 0x20, 0x02, 0x20, 0x01, 0x20, 0x00, 0x81, 0x00,
+  0x27, 0x00, 0x81, 0x02, 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0x02, 0x20,
+  0x00, 0x20, 0x01, 0x20, 0x02, 0x02, 0x28, 0x02, 0x20, 0x00, 0x20, 0x01,
+  0x20, 0x00, 0x20, 0x00, 0x02, 0x20, 0x00, 0x20, 0x01, 0x20, 0x00, 0x20,
+  0x00, 0x02, 0x20, 0x00, 0x20, 0x01, 0x20, 0x00, 0x20, 0x00, 0x00, 0x22,
+  0x00, 0x25, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x05, 0x00, 0x20,
+  0x00, 0x20, 0x00, 0x20, 0x05, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x05,
+  0x00, 0x40, 0x29, 0x0B,
+  // exit masks
+  0x80, 0x88, 0x88, 0x88, 0x88, 0x08, 0x80, 0x88, 0x88, 0x88, 0x88, 0x08,
+  0xA2, 0x66, 0xE6, 0x66, 0x66, 0x4C, 0xA2, 0x66, 0x66, 0x6E, 0x66, 0x4C,
+  0x92, 0x15, 0x93, 0x15, 0x31, 0x49, 0x92, 0x15, 0x31, 0x59, 0x31, 0x49,
+  0x92, 0x8C, 0x9A, 0x8C, 0xA8, 0xC9, 0x9A, 0x8C, 0xA8, 0xC9, 0xA8, 0x49,
+  0x32, 0x66, 0xF6, 0x66, 0x6E, 0x67, 0x76, 0xE6, 0x66, 0x6F, 0x66, 0x45,
+  0x10, 0x11, 0x93, 0x35, 0x59, 0x11, 0x11, 0x93, 0x35, 0x59, 0x11, 0x01,
+  0x80, 0x88, 0x9A, 0x24, 0x49, 0x00, 0x00, 0x92, 0x24, 0xC9, 0x88, 0x08,
+  0xA2, 0x66, 0xD6, 0x24, 0xC9, 0x88, 0x88, 0x9A, 0x24, 0x6B, 0x66, 0x4C,
+  0x92, 0x15, 0x93, 0x24, 0x6B, 0x66, 0x66, 0xD6, 0x24, 0x59, 0x31, 0x49,
+  0x92, 0x04, 0x92, 0x24, 0x59, 0x11, 0x11, 0x93, 0x24, 0x49, 0x20, 0x49,
+  0x92, 0x8C, 0x9A, 0xAC, 0x49, 0x00, 0x00, 0x92, 0xAC, 0xC9, 0xA8, 0x49,
+  0x32, 0xE6, 0xF6, 0x66, 0x4D, 0x00, 0x00, 0xB2, 0x66, 0x6F, 0x6E, 0x45,
+  0x10, 0x93, 0x97, 0x35, 0x49, 0x00, 0x00, 0x92, 0x35, 0x79, 0x59, 0x01,
+  0x00, 0x92, 0x9E, 0xAC, 0xC9, 0x88, 0x88, 0x9A, 0xAC, 0xE9, 0x49, 0x00,
+  0x00, 0xB2, 0xF6, 0x66, 0x6F, 0x6E, 0xE6, 0xF6, 0x66, 0x6F, 0x4D, 0x00,
+  0x00, 0x92, 0x97, 0x35, 0x79, 0x59, 0x93, 0x97, 0x35, 0x79, 0x49, 0x00,
+  0x00, 0x92, 0x96, 0x24, 0x69, 0x49, 0x92, 0x96, 0x24, 0x69, 0x49, 0x00,
+  0x80, 0x9A, 0x96, 0xAC, 0xE9, 0xC9, 0x9A, 0x9E, 0xAC, 0x69, 0xC9, 0x08,
+  0xA2, 0xD6, 0xB6, 0x66, 0x67, 0x67, 0x76, 0x76, 0x66, 0x6D, 0x6B, 0x4C,
+  0x92, 0x97, 0x96, 0x15, 0x11, 0x11, 0x11, 0x11, 0x31, 0x69, 0x79, 0x49,
+  0x92, 0x96, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x69, 0x49,
+  0x92, 0x9E, 0x9E, 0x8C, 0x88, 0x88, 0x88, 0x88, 0xA8, 0xE9, 0xE9, 0x49,
+  0x32, 0x76, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x45,
+  0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01,
+  // junction graph, 38 nodes
+  0x26, 0x1D, 0x00, 0x2A, 0x00, 0x65, 0x00, 0x68, 0x00, 0x6A, 0x00, 0x6D,
+  0x00, 0x6F, 0x00, 0x72, 0x00, 0xAD, 0x00, 0xBA, 0x00, 0xC8, 0x00, 0xCF,
+  0x00, 0x0B, 0x01, 0x0D, 0x01, 0x10, 0x01, 0x17, 0x01, 0x1A, 0x01, 0x1C,
+  0x01, 0x53, 0x01, 0x55, 0x01, 0x58, 0x01, 0x5A, 0x01, 0x5D, 0x01, 0x5F,
+  0x01, 0x62, 0x01, 0x64, 0x01, 0xB3, 0x01, 0xB5, 0x01, 0xB8, 0x01, 0xBA,
+  0x01, 0xBD, 0x01, 0xBF, 0x01, 0xC2, 0x01, 0xC4, 0x01, 0x13, 0x02, 0x15,
+  0x02, 0x22, 0x02, 0x24, 0x02, 0xFF, 0x00, 0x04, 0x08, 0x02, 0x0B, 0x02,
+  0x03, 0xFF, 0x00, 0x07, 0x0B, 0x05, 0x08, 0x07, 0x03, 0x00, 0x03, 0x03,
+  0x03, 0x00, 0x0B, 0x08, 0x03, 0xFF, 0x00, 0x04, 0x02, 0x02, 0x03, 0x0A,
+  0x04, 0x00, 0x08, 0x05, 0x03, 0x03, 0x02, 0xFF, 0x00, 0x01, 0x08, 0x06,
+  0x02, 0x04, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0x03, 0x05, 0x02, 0x0B,
+  0x04, 0x01, 0x03, 0x01, 0x0B, 0x06, 0x03, 0x09, 0x03, 0x02, 0x03, 0xFF,
+  0x00, 0x0C, 0x0A, 0x0D, 0x04, 0x07, 0x03, 0x11, 0x0A, 0xFF, 0x00, 0x10,
+  0x04, 0x03, 0x04, 0x0B, 0x07, 0xFF, 0x00, 0x0E, 0x03, 0x06, 0x04, 0xFF,
+  0x00, 0x0A, 0x07, 0x0F, 0x03, 0xFF, 0x00, 0x0D, 0x02, 0x08, 0x0A, 0x12,
+  0x03, 0x08, 0x04, 0x0E, 0x03, 0x0C, 0x02, 0x13, 0x03, 0x0A, 0x03, 0xFF,
+  0x00, 0x0D, 0x03, 0x14, 0x03, 0x0B, 0x03, 0x10, 0x03, 0xFF, 0x00, 0x17,
+  0x03, 0x09, 0x04, 0x11, 0x02, 0x0F, 0x03, 0x18, 0x03, 0xFF, 0x00, 0x09,
+  0x0A, 0x10, 0x02, 0x19, 0x03, 0x0C, 0x03, 0x13, 0x02, 0xFF, 0x00, 0x1A,
+  0x04, 0x0D, 0x03, 0x14, 0x03, 0x12, 0x02, 0x1B, 0x04, 0x0E, 0x03, 0x15,
+  0x02, 0x13, 0x03, 0x1C, 0x04, 0xFF, 0x00, 0x16, 0x03, 0x14, 0x02, 0x1D,
+  0x04, 0xFF, 0x00, 0x17, 0x02, 0x15, 0x03, 0x1E, 0x04, 0x0F, 0x03, 0x18,
+  0x03, 0x16, 0x02, 0x1F, 0x04, 0x10, 0x03, 0x19, 0x02, 0x17, 0x03, 0x20,
+  0x04, 0x11, 0x03, 0xFF, 0x00, 0x18, 0x02, 0x21, 0x04, 0x12, 0x04, 0xFF,
+  0x00, 0x22, 0x08, 0x22, 0x04, 0x13, 0x04, 0x1C, 0x03, 0xFF, 0x00, 0x23,
+  0x04, 0x14, 0x04, 0x1D, 0x02, 0x1B, 0x03, 0xFF, 0x00, 0x15, 0x04, 0x1E,
+  0x03, 0x1C, 0x02, 0xFF, 0x00, 0x16, 0x04, 0x1F, 0x02, 0x1D, 0x03, 0xFF,
+  0x00, 0x17, 0x04, 0x20, 0x03, 0x1E, 0x02, 0xFF, 0x00, 0x18, 0x04, 0xFF,
+  0x00, 0x1F, 0x03, 0x24, 0x04, 0x19, 0x04, 0x25, 0x08, 0xFF, 0x00, 0x25,
+  0x04, 0x1A, 0x04, 0x23, 0x02, 0x1A, 0x08, 0xFF, 0x00, 0x1B, 0x04, 0x24,
+  0x0D, 0x22, 0x02, 0xFF, 0x00, 0x20, 0x04, 0x25, 0x02, 0x23, 0x0D, 0xFF,
+  0x00, 0x21, 0x04, 0x21, 0x08, 0x24, 0x02, 0xFF, 0x00,
+  // next-hop table
+  0x39, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1A, 0x00, 0x20, 0x00, 0x36,
+  0x00, 0x3A, 0x00, 0x3E, 0x00, 0x4A, 0x00, 0x56, 0x00, 0x5C, 0x00, 0x62,
+  0x00, 0x72, 0x00, 0x78, 0x00, 0x7E, 0x00, 0x90, 0x00, 0x98, 0x00, 0xA0,
+  0x00, 0xA8, 0x00, 0xBC, 0x00, 0xC2, 0x00, 0xC8, 0x00, 0xCE, 0x00, 0xE4,
+  0x00, 0xAA, 0x54, 0x55, 0x55, 0x55, 0x5E, 0xE5, 0x55, 0xFE, 0xFF, 0x57,
+  0x55, 0x55, 0xF5, 0xF5, 0xF5, 0xFF, 0x55, 0xF5, 0xFF, 0x7F, 0xF5, 0x57,
+  0x7F, 0xF5, 0xFF, 0x5F, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F,
+  0x55, 0xFF, 0x57, 0xFF, 0x57, 0xFF, 0x57, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+  0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xAA, 0xAA,
+  0xAA, 0x2A, 0x55, 0xAA, 0xA7, 0x7A, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xA7,
+  0xAF, 0xAF, 0xAA, 0xFF, 0xAF, 0xFE, 0xFF, 0xAF, 0xFE, 0xEA, 0xAF, 0xAA,
+  0xFA, 0xFF, 0xAF, 0xFE, 0xEA, 0xAF, 0xAA, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF,
+  0xEA, 0xFF, 0xEA, 0xFF, 0xAA, 0xEA, 0xFF, 0xFF, 0xFF, 0xEA, 0xAF, 0xFE,
+  0xEA, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x50, 0x55, 0x55,
+  0x52, 0x25, 0x55, 0xAA, 0x54, 0x55, 0x55, 0x55, 0x75, 0x75, 0xF5, 0x7F,
+  0x55, 0xF5, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0xF5,
+  0x55, 0x5F, 0xF5, 0x7F, 0x55, 0x55, 0x55, 0x5F, 0x55, 0x5F, 0x55, 0x5F,
+  0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF,
+  0xFF, 0xFF, 0x7F, 0x55, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x5A, 0xA5, 0x55,
+  0xAA, 0x2A, 0x55, 0x55, 0x55, 0xE5, 0xE5, 0xA5, 0xEA, 0x55, 0xA5, 0xFF,
+  0x7F, 0xA5, 0x57, 0x7A, 0xA5, 0xEA, 0x5F, 0x55, 0xA5, 0x57, 0x7A, 0xA5,
+  0xFE, 0xFF, 0x5F, 0x55, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xAA, 0xFF,
+  0xFF, 0x57, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0xAA, 0x55,
+  0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x4A, 0xA5, 0x54, 0xAA, 0xAA, 0x52,
+  0x55, 0x55, 0xA5, 0xA5, 0xA5, 0xAA, 0x55, 0xA5, 0xAA, 0x56, 0xA5, 0x56,
+  0x6A, 0xA5, 0xAA, 0x5A, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x55,
+  0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0xAA, 0x6A, 0x55, 0x55,
+  0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA,
+  0x0A, 0x00, 0x00, 0x2A, 0xA5, 0x52, 0xAA, 0xAA, 0xAA, 0x54, 0x55, 0xA5,
+  0xA5, 0xA5, 0xAA, 0x55, 0xA5, 0x5A, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA,
+  0x5A, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0x56, 0x55, 0x55, 0x6A, 0x55,
+  0x6A, 0x55, 0x6A, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56,
+  0x6A, 0xA5, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x56, 0x55,
+  0xAA, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0x4A, 0x55, 0xA5, 0xA7, 0xA7, 0xAA,
+  0x57, 0xA5, 0xFE, 0xFF, 0xA5, 0x5E, 0xEA, 0xA5, 0xAA, 0xFA, 0x57, 0xA5,
+  0x5E, 0xEA, 0xA5, 0xAA, 0xFF, 0xFF, 0x57, 0xEA, 0x5F, 0xEA, 0x5F, 0xEA,
+  0x5F, 0xAA, 0xEA, 0xFF, 0xFF, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA,
+  0x56, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xAA, 0xA4, 0x4A,
+  0xAA, 0xAA, 0xAA, 0xAA, 0x52, 0xA5, 0xAE, 0xAE, 0xAA, 0xFE, 0xAF, 0xAA,
+  0xAA, 0xAF, 0xFA, 0xAA, 0xAF, 0xAA, 0xEA, 0xFF, 0xAF, 0xFA, 0xAA, 0xAF,
+  0xAA, 0xAA, 0xEA, 0xFF, 0xAA, 0xFA, 0xAA, 0xFA, 0xAA, 0xFA, 0xAA, 0xAA,
+  0xAA, 0xFA, 0xFF, 0xEA, 0xAF, 0xFE, 0xEA, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x03,
+  0x3E, 0xE0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x07, 0x7C, 0xC0, 0x07, 0x00,
+  0xF0, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0xF0, 0x54, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0x5F, 0x55, 0xF5,
+  0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0x57, 0xFF, 0x57, 0xFF,
+  0x57, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF,
+  0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x80, 0x00, 0xA0, 0xAA,
+  0x2A, 0xAF, 0xFE, 0xEA, 0xAF, 0xAA, 0xFA, 0xFF, 0xAF, 0xFE, 0xEA, 0xAF,
+  0xAA, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xEA, 0xFF, 0xEA, 0xFF, 0xAA, 0xEA,
+  0xFF, 0xFF, 0xFF, 0xEA, 0xAF, 0xFE, 0xEA, 0xAF, 0xAA, 0xFA, 0xFF, 0xFF,
+  0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x65, 0x55, 0x55, 0x65, 0x55,
+  0x56, 0xA5, 0x54, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x55, 0x55, 0x55,
+  0x55, 0x57, 0x55, 0x57, 0x55, 0x57, 0x55, 0x7F, 0x55, 0x55, 0x55, 0x55,
+  0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x41, 0x01, 0x40, 0x01, 0x20, 0x55, 0x55, 0x25, 0x55, 0x52, 0xA5, 0x4A,
+  0x55, 0x55, 0xE5, 0x55, 0x5E, 0xE5, 0x7F, 0x55, 0x55, 0x55, 0x5E, 0x55,
+  0x5E, 0x55, 0x5E, 0x55, 0xEA, 0x5F, 0x55, 0x55, 0x55, 0x7A, 0xA5, 0x57,
+  0x7A, 0xA5, 0xFE, 0xFF, 0xFF, 0x7F, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xA0, 0x2A,
+  0x00, 0xA0, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0xA0, 0xAA, 0x02, 0x00, 0xA0,
+  0xFF, 0xFA, 0xAF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA,
+  0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAF, 0xFE, 0xEA, 0xAF, 0xAA,
+  0xAA, 0xAA, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x54, 0x05, 0x00,
+  0x00, 0x05, 0x50, 0x00, 0x05, 0x00, 0x40, 0x55, 0xF5, 0x5F, 0xFF, 0xF5,
+  0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0x5F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0x57, 0x55, 0x55,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x82, 0x02, 0x80, 0x02, 0xA0, 0xAA, 0xAA, 0xA4, 0x4A,
+  0xAA, 0xA4, 0xAA, 0xAA, 0x52, 0xA5, 0x7A, 0xAA, 0xA7, 0xAA, 0xAA, 0xEA,
+  0x7F, 0xAA, 0x7A, 0xAA, 0x7A, 0xAA, 0x7A, 0xAA, 0xAA, 0xAA, 0xFA, 0x57,
+  0xEA, 0xA5, 0x5E, 0xEA, 0xA5, 0xEA, 0xFF, 0xFF, 0xFF, 0x57, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0x6A, 0xA5, 0xAA, 0xAA, 0xA6, 0x6A, 0xAA, 0xA6, 0xAA,
+  0xAA, 0x2A, 0xA5, 0xEA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xEA,
+  0xAA, 0xEA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAF, 0xFA,
+  0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00,
+  0x54, 0x05, 0x00, 0x00, 0x05, 0x54, 0x40, 0x05, 0x00, 0x50, 0x55, 0x45,
+  0x55, 0x54, 0x45, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x57, 0x55, 0x57,
+  0x55, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0x5F,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x54, 0x05, 0x00,
+  0x00, 0x05, 0x54, 0x40, 0x05, 0x00, 0x50, 0x55, 0x25, 0x55, 0x52, 0xA5,
+  0x54, 0x55, 0x55, 0x55, 0x5E, 0x55, 0x5E, 0x55, 0x5E, 0x55, 0xEA, 0x5F,
+  0x55, 0x55, 0x55, 0x7A, 0xA5, 0x57, 0x7A, 0xA5, 0xFE, 0xFF, 0xFF, 0x7F,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x54, 0x05, 0x00, 0x00, 0x05, 0x54,
+  0x40, 0x05, 0x00, 0x50, 0x55, 0xA5, 0x54, 0x4A, 0xA5, 0x2A, 0x55, 0x55,
+  0x55, 0x7A, 0x55, 0x7A, 0x55, 0x7A, 0x55, 0xAA, 0xFF, 0x55, 0x55, 0x55,
+  0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA,
+  0x5A, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0xA5,
+  0xA5, 0xA5, 0xAA, 0x55, 0xA5, 0xAA, 0x56, 0xA5, 0x56, 0x6A, 0xA5, 0xAA,
+  0x5A, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0x52, 0x55, 0x55, 0xEA, 0x55,
+  0xEA, 0x55, 0xEA, 0x55, 0xAA, 0xEA, 0x7F, 0x55, 0x55, 0x6A, 0xA5, 0x56,
+  0x6A, 0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xAA, 0x5A, 0x55, 0x55, 0x55,
+  0x5A, 0xA5, 0x55, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0xA5, 0xA5, 0xA5, 0xAA,
+  0x55, 0xA5, 0x5A, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0x5A, 0x55, 0xA5,
+  0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x54, 0x55, 0xAA, 0x57, 0xAA, 0x57, 0xAA,
+  0x57, 0xAA, 0xAA, 0xFE, 0x57, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA,
+  0x6A, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xA0, 0x2A, 0x00, 0xA0, 0x00,
+  0x00, 0xA0, 0x02, 0x2A, 0xA0, 0xAA, 0x0A, 0x00, 0xA0, 0x52, 0x2A, 0xA5,
+  0xAA, 0xAA, 0x4A, 0x55, 0xAA, 0x5E, 0xAA, 0x5E, 0xAA, 0x5E, 0xAA, 0xAA,
+  0xAA, 0xFF, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0x56, 0x55, 0x55,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x20, 0xA0, 0x2A, 0x00, 0xA0, 0x00, 0x00, 0xA0, 0x02,
+  0x2A, 0xA0, 0xAA, 0x0A, 0x00, 0xA0, 0x4A, 0xAA, 0xA4, 0xAA, 0xAA, 0xAA,
+  0x52, 0xAA, 0x7A, 0xAA, 0x7A, 0xAA, 0x7A, 0xAA, 0xAA, 0xAA, 0xFA, 0x57,
+  0xEA, 0xA5, 0x5E, 0xEA, 0xA5, 0xEA, 0xFF, 0xFF, 0xFF, 0x57, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x20, 0xA0, 0x2A, 0x00, 0xA0, 0x00, 0x00, 0xA0, 0x02, 0x2A, 0xA0, 0xAA,
+  0x0A, 0x00, 0xA0, 0x2A, 0xAA, 0xA2, 0xAA, 0xAA, 0xAA, 0x2A, 0xAA, 0xEA,
+  0xAA, 0xEA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAF, 0xFA,
+  0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xEF, 0xFF, 0xFE, 0xEF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x15, 0x50, 0x15, 0x50, 0x15, 0x00, 0x55,
+  0x55, 0x55, 0x01, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x15, 0x48, 0x15, 0x48, 0x15, 0x80, 0x4A, 0x55, 0x55, 0x01,
+  0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x15,
+  0x28, 0x15, 0x28, 0x15, 0x80, 0xAA, 0x54, 0x55, 0x01, 0x6A, 0xA5, 0x56,
+  0x6A, 0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x14, 0xA8, 0x14, 0xA8,
+  0x14, 0x80, 0xAA, 0x2A, 0x55, 0x01, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA,
+  0x6A, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xA8, 0x12, 0xA8, 0x12, 0xA8, 0x12, 0x80, 0xAA,
+  0xAA, 0x52, 0x01, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0x56, 0x55, 0x55,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA8, 0x0A, 0xA8, 0x0A, 0xA8, 0x0A, 0x80, 0xAA, 0xAA, 0xAA, 0x00,
+  0xEA, 0xAF, 0xFE, 0xEA, 0xAF, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xF7, 0x7F,
+  0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x54, 0x55, 0x54,
+  0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x52, 0x25, 0x55, 0x52, 0xA5, 0x54,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x2A, 0x00,
+  0x00, 0x00, 0x54, 0x4A, 0xA5, 0x54, 0x4A, 0xA5, 0x4A, 0x55, 0x55, 0x55,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x2A, 0x00, 0x00, 0x00, 0x54,
+  0x2A, 0xA5, 0x52, 0x2A, 0xA5, 0xAA, 0xAA, 0xAA, 0x2A, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x2A,
+  0xAA, 0x2A, 0xAA, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0xAA, 0xA4, 0x4A,
+  0xAA, 0xA4, 0xAA, 0xAA, 0xAA, 0xAA, 0x52,
+  // 03_arcade.txt
+  31, 28, 23, 13,
+  0x0D, 0x00, 0x2B, 0x00, 0x00, 0x20, 0x03, 0x20, 0x04, 0x20, 0x00, 0x00,
+  0x40, 0x03, 0x20, 0x04, 0x20, 0x00, 0x00, 0x20, 0x03, 0x20, 0x04, 0x20,
+  0x00, 0x00, 0x2C, 0x00, 0x20, 0x03, 0x20, 0x01, 0x20, 0x03, 0x00, 0x20,
+  0x03, 0x20, 0x01, 0x20, 0x03, 0x00, 0x25, 0x01, 0x23, 0x00, 0x05, 0x20,
+  0x04, 0x60, 0x00, 0x84, 0x00, 0x20, 0x04, 0x60, 0x00, 0x84, 0x00, 0x20,
+  0x01, 0x64, 0x84, 0x00, 0x20, 0x01, 0x60, 0x02, 0x80, 0x05, 0x20, 0x01,
+  0x60, 0x00, 0x82, 0x05, 0x20, 0x62, 0x00, 0x82, 0x05, 0x20, 0x01, 0x60,
+  0x00, 0x82, 0x84, 0x00, 0x20, 0x01, 0x60, 0x03, 0x84, 0x00, 0x20, 0x01,
+  0x64, 0x84, 0x00, 0x20, 0x01, 0x60, 0x03, 0x05, 0x20, 0x01, 0x60, 0x03,
+  0x00, 0x2B, 0x00, 0x00, 0x20, 0x03, 0x20, 0x04, 0x20, 0x00, 0x00, 0x20,
+  0x03, 0x20, 0x04, 0x20, 0x00, 0x00, 0x40, 0x21, 0x01, 0x26, 0x60, 0x02,
+  0x20, 0x01, 0x20, 0x01, 0x20, 0x03, 0x02, 0x20, 0x01, 0x20, 0x01, 0x20,
+  0x03, 0x00, 0x25, 0x01, 0x23, 0x00, 0x00, 0x20, 0x09, 0x20, 0x00, 0x00,
+  0x20, 0x09, 0x20, 0x00, 0x00, 0x2C, 0x0D,
+  // exit masks
+  0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x08, 0x80, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x08, 0xA2, 0x66, 0x66, 0x6E, 0x66, 0x66, 0x4C, 0xA2, 0x66, 0x66,
+  0xE6, 0x66, 0x66, 0x4C, 0x92, 0x15, 0x31, 0x59, 0x11, 0x31, 0x49, 0x92,
+  0x15, 0x11, 0x93, 0x15, 0x31, 0x49, 0x92, 0x04, 0x20, 0x49, 0x00, 0x20,
+  0x49, 0x92, 0x04, 0x00, 0x92, 0x04, 0x20, 0x49, 0x92, 0x8C, 0xA8, 0xC9,
+  0x88, 0xA8, 0xC9, 0x9A, 0x8C, 0x88, 0x9A, 0x8C, 0xA8, 0x49, 0xB2, 0x66,
+  0x66, 0x6F, 0xE6, 0x66, 0x67, 0x76, 0x66, 0x6E, 0xF6, 0x66, 0x66, 0x4D,
+  0x92, 0x15, 0x31, 0x59, 0x93, 0x15, 0x11, 0x11, 0x31, 0x59, 0x93, 0x15,
+  0x31, 0x49, 0x92, 0x8C, 0xA8, 0x49, 0x92, 0x8C, 0x08, 0x80, 0xA8, 0x49,
+  0x92, 0x8C, 0xA8, 0x49, 0x32, 0x66, 0x66, 0x4D, 0x32, 0x66, 0x4C, 0xA2,
+  0x66, 0x45, 0xB2, 0x66, 0x66, 0x45, 0x10, 0x11, 0x31, 0x49, 0x10, 0x31,
+  0x49, 0x92, 0x15, 0x01, 0x92, 0x15, 0x11, 0x01, 0x00, 0x00, 0x20, 0x49,
+  0x80, 0xA8, 0xC9, 0x9A, 0x8C, 0x08, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x49, 0xA2, 0x66, 0x67, 0x76, 0x66, 0x4C, 0x92, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x49, 0x92, 0x15, 0x11, 0x11, 0x31, 0x49, 0x92, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0xC9, 0x9A, 0x04, 0x00, 0x00, 0x20, 0xC9,
+  0x9A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x6B, 0xD6, 0x04, 0x00, 0x00,
+  0x20, 0x6B, 0xD6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x59, 0x93, 0x04,
+  0x00, 0x00, 0x20, 0x59, 0x93, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x49,
+  0x92, 0x8C, 0x88, 0x88, 0xA8, 0x49, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x49, 0xB2, 0x66, 0x66, 0x66, 0x66, 0x4D, 0x92, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x49, 0x92, 0x15, 0x11, 0x11, 0x31, 0x49, 0x92, 0x04,
+  0x00, 0x00, 0x80, 0x88, 0xA8, 0xC9, 0x9A, 0x8C, 0x08, 0x80, 0xA8, 0xC9,
+  0x9A, 0x8C, 0x88, 0x08, 0xA2, 0x66, 0x66, 0x6F, 0x76, 0x66, 0x4C, 0xA2,
+  0x66, 0x67, 0xF6, 0x66, 0x66, 0x4C, 0x92, 0x15, 0x31, 0x59, 0x11, 0x31,
+  0x49, 0x92, 0x15, 0x11, 0x93, 0x15, 0x31, 0x49, 0x92, 0x8C, 0x20, 0xC9,
+  0x88, 0xA8, 0xC9, 0x9A, 0x8C, 0x88, 0x9A, 0x04, 0xA8, 0x49, 0x32, 0xC6,
+  0x24, 0x6B, 0xE6, 0x66, 0x67, 0x76, 0x66, 0x6E, 0xD6, 0x24, 0x6A, 0x45,
+  0x10, 0x93, 0x24, 0x59, 0x93, 0x15, 0x11, 0x11, 0x31, 0x59, 0x93, 0x24,
+  0x59, 0x01, 0x80, 0x9A, 0xAC, 0x49, 0x92, 0x8C, 0x08, 0x80, 0xA8, 0x49,
+  0x92, 0xAC, 0xC9, 0x08, 0xA2, 0x76, 0x66, 0x45, 0x32, 0x66, 0x4C, 0xA2,
+  0x66, 0x45, 0x32, 0x66, 0x67, 0x4C, 0x92, 0x15, 0x11, 0x01, 0x10, 0x31,
+  0x49, 0x92, 0x15, 0x01, 0x10, 0x11, 0x31, 0x49, 0x92, 0x8C, 0x88, 0x88,
+  0x88, 0xA8, 0xC9, 0x9A, 0x8C, 0x88, 0x88, 0x88, 0xA8, 0x49, 0x32, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x67, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x45,
+  0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x01,
+  // junction graph, 34 nodes
+  0x22, 0x22, 0x00, 0x31, 0x00, 0x8D, 0x00, 0x92, 0x00, 0x95, 0x00, 0x98,
+  0x00, 0x9B, 0x00, 0x9E, 0x00, 0xA1, 0x00, 0xA6, 0x00, 0xE6, 0x00, 0xF5,
+  0x00, 0x40, 0x01, 0x43, 0x01, 0x8E, 0x01, 0x91, 0x01, 0x9A, 0x01, 0x9D,
+  0x01, 0xE5, 0x01, 0xEE, 0x01, 0x36, 0x02, 0x39, 0x02, 0x42, 0x02, 0x45,
+  0x02, 0x8A, 0x02, 0x8D, 0x02, 0x90, 0x02, 0x93, 0x02, 0x96, 0x02, 0x99,
+  0x02, 0xDB, 0x02, 0xF0, 0x02, 0x38, 0x03, 0x3B, 0x03, 0xFF, 0x00, 0x05,
+  0x0A, 0x02, 0x09, 0x03, 0x04, 0xFF, 0x00, 0x09, 0x09, 0x06, 0x0A, 0x08,
+  0x04, 0x00, 0x09, 0x03, 0x05, 0xFF, 0x00, 0x0A, 0x08, 0x00, 0x04, 0x04,
+  0x03, 0x02, 0x05, 0x0A, 0x03, 0xFF, 0x00, 0x05, 0x03, 0x03, 0x03, 0x0C,
+  0x09, 0x00, 0x0A, 0x06, 0x03, 0x04, 0x03, 0xFF, 0x00, 0x01, 0x0A, 0x07,
+  0x03, 0x05, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x08, 0x03, 0x06, 0x03, 0x0D,
+  0x09, 0x01, 0x04, 0x09, 0x05, 0x07, 0x03, 0x0B, 0x03, 0x01, 0x09, 0xFF,
+  0x00, 0x08, 0x05, 0x0B, 0x08, 0x03, 0x03, 0xFF, 0x00, 0x02, 0x08, 0x0E,
+  0x06, 0x08, 0x03, 0x09, 0x08, 0xFF, 0x00, 0x11, 0x06, 0x04, 0x09, 0x0D,
+  0x03, 0x0F, 0x06, 0xFF, 0x00, 0x07, 0x09, 0x10, 0x06, 0x0C, 0x03, 0xFF,
+  0x00, 0x0A, 0x06, 0x0F, 0x03, 0xFF, 0x00, 0x14, 0x06, 0x0C, 0x06, 0xFF,
+  0x00, 0x0E, 0x03, 0x12, 0x03, 0x0D, 0x06, 0x11, 0x03, 0xFF, 0x00, 0x13,
+  0x03, 0x0B, 0x06, 0xFF, 0x00, 0x10, 0x03, 0x17, 0x06, 0x0F, 0x03, 0x13,
+  0x09, 0xFF, 0x00, 0x15, 0x03, 0x10, 0x03, 0xFF, 0x00, 0x12, 0x09, 0x16,
+  0x03, 0x0E, 0x06, 0x15, 0x03, 0x1E, 0x0D, 0x18, 0x03, 0x12, 0x03, 0x1A,
+  0x06, 0x14, 0x03, 0xFF, 0x00, 0x13, 0x03, 0x17, 0x03, 0x1B, 0x06, 0xFF,
+  0x00, 0x11, 0x06, 0x1F, 0x0D, 0x16, 0x03, 0x1D, 0x03, 0x14, 0x03, 0x19,
+  0x03, 0xFF, 0x00, 0x1E, 0x06, 0xFF, 0x00, 0x1A, 0x03, 0x18, 0x03, 0x20,
+  0x09, 0x15, 0x06, 0x1B, 0x03, 0x19, 0x03, 0xFF, 0x00, 0x16, 0x06, 0x1C,
+  0x03, 0x1A, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x1D, 0x03, 0x1B, 0x03, 0x21,
+  0x09, 0x17, 0x03, 0xFF, 0x00, 0x1C, 0x03, 0x1F, 0x06, 0x14, 0x0D, 0x18,
+  0x06, 0x20, 0x10, 0xFF, 0x00, 0x17, 0x0D, 0x21, 0x10, 0x1D, 0x06, 0xFF,
+  0x00, 0x19, 0x09, 0x21, 0x03, 0x1E, 0x10, 0xFF, 0x00, 0x1C, 0x09, 0x1F,
+  0x10, 0x20, 0x03, 0xFF, 0x00,
+  // no next-hop table
+  0x00,
+};
+
+#endif
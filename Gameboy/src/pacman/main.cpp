@@ -14,19 +14,26 @@
 #include "shared.h"
 #include "global.h"
 #include "game.h"
+#include "autopilot.h"
 
-int near(float f) {
-    return int(round(f));
+// get what tile a sub-tile coordinate is closest to
+int near(int16_t p) {
+    return (p + SUBTILE/2) / SUBTILE;
+}
+
+// convert a sub-tile coordinate to a pixel offset within the map
+int16_t toPixels(int16_t p) {
+    return int32_t(p) * SCALE / SUBTILE;
 }
 
 // cast of the game
 PacManShape pacShape; // our hero
 
 // the bad guys
-GhostShape redShape(GhostData::redInitialPos, GhostData::redColor);
-GhostShape blueShape(GhostData::blueInitialPos, GhostData::blueColor);
-GhostShape pinkShape(GhostData::pinkInitialPos, GhostData::pinkColor);
-GhostShape orangeShape(GhostData::orangeInitialPos, GhostData::orangeColor);
+GhostShape redShape(GhostData::redColor);
+GhostShape blueShape(GhostData::blueColor);
+GhostShape pinkShape(GhostData::pinkColor);
+GhostShape orangeShape(GhostData::orangeColor);
 
 // pointers required for polymorphism
 PacManShape * pacShapeP = &pacShape; 
@@ -35,6 +42,87 @@ GhostShape * blueShapeP = &blueShape;
 GhostShape * pinkShapeP = &pinkShape;
 GhostShape * orangeShapeP = &orangeShape;
 
+// draw each maze tile as the level loader decodes it
+void drawDecodedTile(int16_t r, int16_t c) {
+  // first tile of a new level: size the view and aim the camera
+  if (r == 0 && c == 0) {
+    DrawMap::fitLevel(&tft, myMap.rows, myMap.cols, pacCore.layout.pacRow);
+  }
+  DrawMap::drawTile(&tft, r, c);
+}
+
+// screen position (in pixels) of an actor's shape
+Coordinates screenPos(const Actor & a) {
+  Coordinates cord;
+  cord.x = toPixels(a.draw().pos.x) + DrawMap::mapStartX;
+  cord.y = toPixels(a.draw().pos.y) + DrawMap::mapStartY
+    - DrawMap::cameraRow*DrawMap::tileSize;
+  return cord;
+}
+
+// every shape, for checking which ones were drawn over
+Shape * const allShapes[] = {
+  &pacShape, &redShape, &blueShape, &pinkShape, &orangeShape
+};
+
+// after s sent a window, make the shapes it drew over draw again
+void touchUp(Shape * s) {
+  for (Shape * other : allShapes) {
+    if (other != s && other->coveredBy(*s)) other->invalidate();
+  }
+}
+
+// put the map back under a shape (using the current camera) and take
+// it off the screen
+void repaintUnder(Shape * s) {
+  if (s->isHidden()) return;
+  s->erase(&tft);
+  touchUp(s);
+}
+
+// move a shape to cord, keeping it off the screen while cord is outside
+// the map view. Returns true if the shape should be drawn.
+bool placeShape(Shape * s, Coordinates cord) {
+  if (!s->fitsView(cord)) {
+    repaintUnder(s);
+    return false;
+  }
+  if (s->isHidden()) s->placeAt(cord);
+  else s->setPosition(cord);
+  return true;
+}
+
+// scroll the map view to follow pac-man. There's no spare video memory
+// to scroll in, so tiles are redrawn, but only those that look different
+// once the view has moved (walls mostly line up from row to row) and the
+// ones under the shapes and ghost door drawn for the old view.
+void updateCamera() {
+  int8_t old = DrawMap::cameraRow;
+  int8_t top = DrawMap::cameraFor(near(pac.draw().pos.y), myMap.rows);
+  if (top == old) return;
+  DrawMap::cameraRow = top;
+
+  for (int8_t s = 0; s < DrawMap::viewRows; s++) {
+    for (int8_t c = 0; c < myMap.cols; c++) {
+      if (myMap.tileAt(old + s, c) != myMap.tileAt(top + s, c))
+        DrawMap::drawTile(&tft, top + s, c);
+    }
+  }
+
+  repaintUnder(pacShapeP);
+  repaintUnder(redShapeP);
+  repaintUnder(blueShapeP);
+  repaintUnder(pinkShapeP);
+  repaintUnder(orangeShapeP);
+
+  const LevelLayout &l = pacCore.layout;
+  int16_t doorRow = l.houseTop - old + top; // map row now where the door was
+  for (int8_t c = l.doorCol; c < l.doorCol + l.doorWidth; c++) {
+    DrawMap::drawTile(&tft, doorRow, c);
+  }
+  DrawMap::drawGhostDoor(&tft);
+}
+
 // show game over message on screen
 void drawGameOver(bool winner) {
   tft.fillRect(InfoBarData::bottomBarLabelPos.x, 
@@ -58,31 +146,11 @@ void updateLives() {
   LivesBar::drawLives(&tft, InfoBarData::bottomBarValuePos, game.getRemainingLives());
 }
 
-// update ghost based on pac-man's current state
-void runGhost(Ghost &g)
-{
-  if (pac.powerful == 1) {
-    g.setCurrentMode(Frightened);
-  }
-  else if (pac.powerful == 0 && g.getCurrentMode() != Chase) {
-    g.setCurrentMode(Chase);
-  }
-  g.action();
-}
-
-// update state of the four ghosts
-void updateGhosts(){
-  runGhost(red);
-  runGhost(pink);
-  runGhost(blue);
-  runGhost(orange);
-}
-
 // toggles ghost color if in last moments of power pellet effect duration.
 // returns true if ghost is transitioning from Frightened to Chase mode soon.
 // returns false otherwise.
 bool tryFrightenedToggle(GhostShape * gs) {
-  if (millis() - pac.powerTimeStart >= 2*PacMan::powerTimeDuration/3) {
+  if (pac.powerTicksLeft <= pac.powerDuration/3) {
     gs->frightenedToggle = !gs->frightenedToggle;
     return true;
   }
@@ -93,41 +161,21 @@ bool tryFrightenedToggle(GhostShape * gs) {
 // Draw red ghost based on current mode and position.
 void drawGhost(Ghost & g, GhostShape * gp){
   // convert tile coords to display coords (in pixels)
-  Coordinates cord;
-  cord.x = g.draw().pos.x*SCALE + DrawMap::mapStartX + 1;  // +1 to center
-  cord.y = g.draw().pos.y*SCALE + DrawMap::mapStartY + 1;  // +1 to center
-  gp->setPosition(cord);
+  if (!placeShape(gp, screenPos(g))) return;
+
+  // skirt flaps every 8 frames
+  uint8_t skirt = (pacCore.tick >> 3) & 1;
 
   // ghost should "blink" before returning to normal mode
+  bool drawn;
   if (g.getCurrentMode() == Frightened) {
-    if (tryFrightenedToggle(gp)) gp->drawTogglingGhost(&tft);
-    else gp->drawPanickedGhost(&tft);
+    if (tryFrightenedToggle(gp)) drawn = gp->drawTogglingGhost(&tft, skirt);
+    else drawn = gp->drawPanickedGhost(&tft, skirt);
   }
   else {
-    gp->drawShape(&tft);
-  }
-
-  // redraw previous tile 
-  int c = g.lastTile.x;
-  int r = g.lastTile.y;
-  int t = myMap.mapLayout[r][c];
-  
-  // Always redraw the path first (clears the ghost's trail)
-  DrawMap::drawPath(&tft, DrawMap::mapStartX + c*DrawMap::tileSize, 
-            DrawMap::mapStartY + r*DrawMap::tileSize);
-  
-  // Then draw dot or power pellet if they exist
-  if (t == MapData::dot)
-  {
-    DrawMap::drawDot(&tft, DrawMap::mapStartX + c*DrawMap::tileSize, 
-              DrawMap::mapStartY + r*DrawMap::tileSize);
+    drawn = gp->drawGhost(&tft, skirt);
   }
-  else if (t == MapData::powerPellet)
-  {
-    DrawMap::drawPowerPellet(&tft, DrawMap::mapStartX + c*DrawMap::tileSize, 
-              DrawMap::mapStartY + r*DrawMap::tileSize);
-  }
-  // Note: barePath and nonPlayArea are already drawn by drawPath() above
+  if (drawn) touchUp(gp);
 }
 
 // draw the ghosts on-screen
@@ -138,49 +186,13 @@ void drawGhosts() {
   drawGhost(orange, orangeShapeP);
 }
 
-// update state of PacMan
-// side effects: 
-//   - map tiles may change if pac-man eats a pellet or dot.
-//   - score may increase for same reason.
-//   - remaining lives may decrease if a ghost eats pacman
-void updatePacMan() {
-  pac.action();
-}
-
 void drawPacMan() {
-  // Redraw the tile Pac-Man just left (to erase the trail)
-  static CoordinatesF lastPacPos = pac.draw().pos;
-  int lastRow = near(lastPacPos.y);
-  int lastCol = near(lastPacPos.x);
-  
-  // Only redraw if Pac-Man has moved to a new tile
-  if (near(pac.draw().pos.y) != lastRow || near(pac.draw().pos.x) != lastCol) {
-    int t = myMap.mapLayout[lastRow][lastCol];
-    
-    // Redraw the tile background (removes Pac-Man's trail)
-    DrawMap::drawPath(&tft, DrawMap::mapStartX + lastCol*DrawMap::tileSize, 
-                      DrawMap::mapStartY + lastRow*DrawMap::tileSize);
-    
-    // Redraw dot if it still exists
-    if (t == MapData::dot) {
-      DrawMap::drawDot(&tft, DrawMap::mapStartX + lastCol*DrawMap::tileSize, 
-                       DrawMap::mapStartY + lastRow*DrawMap::tileSize);
-    }
-    // Redraw power pellet if it still exists
-    else if (t == MapData::powerPellet) {
-      DrawMap::drawPowerPellet(&tft, DrawMap::mapStartX + lastCol*DrawMap::tileSize, 
-                               DrawMap::mapStartY + lastRow*DrawMap::tileSize);
-    }
-    
-    lastPacPos = pac.draw().pos;
-  }
-  
- // Draw Pac-Man in current position
-  Coordinates cord;
-  cord.x = pac.draw().pos.x*SCALE + DrawMap::mapStartX + 1;  // +1 to center in 4px tile
-  cord.y = pac.draw().pos.y*SCALE + DrawMap::mapStartY + 1;  // +1 to center in 4px tile
-  pacShapeP->setPosition(cord);
-  pacShapeP->drawShape(&tft);
+  if (!placeShape(pacShapeP, screenPos(pac))) return;
+
+  // mouth opens and shuts once per tile, so it stays still when he does
+  objectInfo p = pac.draw();
+  bool open = (p.pos.x + p.pos.y) % SUBTILE < SUBTILE/2;
+  if (pacShapeP->drawPacMan(&tft, p.dir, open)) touchUp(pacShapeP);
 }
 
 // draw score bar (label and value) on-screen
@@ -195,26 +207,18 @@ void drawLivesBar() {
   LivesBar::drawLives(&tft, InfoBarData::bottomBarValuePos, game.getRemainingLives());
 }
 
-// initialize or re-initialize our important variables,
-// and restart game from initial state
-void restart() {
-  // initialize state variables
-  game = Game(3); // start with 3 lives
-  Controller con;
-  myMap = MapData();
-  pac = PacMan();
-  red = Ghost(13.0f,11.0f,0.1f,DOWN,0);  //0 -> never makes a wrong turn
-  pink = Ghost(15.0f,16.0f,0.125f,UP,300);  // 30% error rate
-  blue = Ghost(15.0f,11.0f,0.125f,RIGHT,200); // makes a wrong turn 20.0% of the time
-  orange = Ghost(13.0f,16.0f,0.125f,LEFT,100); // 100% error rate --> ghost is unpredictable
-
+// put everyone in their starting positions and draw the info bars for
+// a new game (the maze is already on screen)
+void drawNewGame() {
+  DrawMap::drawGhostDoor(&tft);
+  pacCore.levelChanged = false;
 
   // initialize our shapes
   pacShape = PacManShape();
-  redShape = GhostShape(GhostData::redInitialPos, GhostData::redColor);
-  blueShape = GhostShape(GhostData::blueInitialPos, GhostData::blueColor);
-  pinkShape = GhostShape(GhostData::pinkInitialPos, GhostData::pinkColor);
-  orangeShape = GhostShape(GhostData::orangeInitialPos, GhostData::orangeColor);
+  redShape = GhostShape(GhostData::redColor);
+  blueShape = GhostShape(GhostData::blueColor);
+  pinkShape = GhostShape(GhostData::pinkColor);
+  orangeShape = GhostShape(GhostData::orangeColor);
   
   // pointers required for polymorphism
   pacShapeP = &pacShape; 
@@ -223,27 +227,67 @@ void restart() {
   pinkShapeP = &pinkShape;
   orangeShapeP = &orangeShape;
 
-  tft.setTextSize(FONT_SIZE);
-
-  // draw map
-  Display::drawBackground(&tft);
-  myMap.initMapLayout();
-  DrawMap::drawMap(&tft);
-  
   // draw everyone in their starting positions
-  pacShapeP->drawShape(&tft);
-  redShapeP->drawShape(&tft);
-  blueShapeP->drawShape(&tft);
-  pinkShapeP->drawShape(&tft);
-  orangeShapeP->drawShape(&tft);
+  drawPacMan();
+  drawGhosts();
   
-  // draw info bars
+  // draw info bars (the bottom one may still say who won)
+  tft.fillRect(InfoBarData::bottomBarLabelPos.x, 
+    InfoBarData::bottomBarLabelPos.y, Display::width, FONT_HEIGHT, 
+    ST7735_BLACK);
   drawScoreBar();
   drawLivesBar();
+}
+
+// initialize or re-initialize our important variables,
+// and restart game from initial state
+void restart() {
+  tft.setTextSize(FONT_SIZE);
+  Display::drawBackground(&tft);
+
+  // initialize state variables
+  // (the first level's maze is drawn while it loads)
+  pacCore.tileDecoded = drawDecodedTile;
+  pacCore.reset(CoreConfig::defaults()); // start with 3 lives
+  drawNewGame();
 
   delay(2000); // give the player a short pause before game begins
 }
 
+// start over straight after a game over, keeping what's on screen.
+// If the game ended on the first maze, the only tiles that differ from
+// a fresh one are those whose dot or pellet was eaten, so only those
+// (and the squares under the shapes) are redrawn.
+void playAgain() {
+  repaintUnder(pacShapeP);
+  repaintUnder(redShapeP);
+  repaintUnder(blueShapeP);
+  repaintUnder(pinkShapeP);
+  repaintUnder(orangeShapeP);
+
+  bool sameMaze = pacCore.level == 0;
+  uint8_t eaten[sizeof myMap.pickups];
+  memcpy(eaten, myMap.pickups, sizeof eaten);
+
+  // another maze is drawn while it loads, as usual
+  pacCore.tileDecoded = sameMaze ? 0 : drawDecodedTile;
+  pacCore.reset(CoreConfig::defaults());
+  pacCore.tileDecoded = drawDecodedTile;
+
+  if (sameMaze) {
+    for (uint16_t i = 0; i < sizeof eaten; i++) {
+      uint8_t changed = eaten[i] ^ myMap.pickups[i];
+      for (uint8_t b = 0; changed != 0; b++, changed >>= 1) {
+        if (changed & 1) {
+          uint16_t tile = 8*i + b;
+          DrawMap::drawTile(&tft, tile / X_BOUND, tile % X_BOUND);
+        }
+      }
+    }
+  }
+  drawNewGame();
+}
+
 
 // initialize our game variables
 void pacmanGameSetup() {
@@ -259,81 +303,43 @@ void pacmanGameSetup() {
     restart();
 }
 
-// teleport everyone home
-void goHome()
-{
-  pac.tpTo(18.0f,11.0f,LEFT);
-  red.tpTo(13.0f,11.0f,DOWN);
-  pink.tpTo(15.0f,16.0f,UP);
-  blue.tpTo(15.0f,11.0f,RIGHT);
-  orange.tpTo(13.0f,16.0f,LEFT); 
-}
-
-// check ghost state against pac-man's state
-void checkGhost(Ghost &g)
-{
-  // pac-man and ghost are in a fight to the death,
-  // and only one can survive...
-  if (CoordinatesF::touching(pac.draw().pos, g.draw().pos))
-  {
-    // ghost kills pac-man :(
-    if (g.getCurrentMode() != Frightened)
-    {
-      delay(Game::deathDelay); // give player time to react
-      goHome();
-      game.loseLife();
-      game.livesChanged = true;
-    }
+// frames since the player last moved the stick
+uint16_t idleFrames = 0;
 
-    // pac-man kills ghost :)
-    // send ghost home for a time out.
-    else
-    {
-      g.tpTo(13.0f,12.0f,LEFT); 
-      g.setCurrentMode(Chase);
-    }
-  }
+// true while the autopilot is playing (attract mode)
+bool attractMode() {
+  return idleFrames >= ATTRACT_IDLE_FRAMES;
 }
 
-
 // check and update state of game
 void update() {
-  updatePacMan();
-  updateGhosts();
-
-  // compare ghost states to pac-man
-  checkGhost(orange);
-  checkGhost(blue);
-  checkGhost(pink);
-  checkGhost(red);
-
-  // early game conditions for releasing ghosts
-  //   - red is released immediately
-  //   - pink is released after 20 points
-  //   - blue is released after 35 points
-  //   - orange is released after 50 points
-  if(game.getScore()>20 && pink.draw().pos == CoordinatesF({13.0f,13.0f}))
-  {
-    pink.tpTo(11.0f,13.0f,LEFT);
-  }
-  else if (game.getScore()>35 && blue.draw().pos == CoordinatesF({13.0f,13.0f}))
-  {
-    blue.tpTo(11.0f,13.0f,LEFT);
-  }
-  else if (game.getScore()>50 && orange.draw().pos == CoordinatesF({13.0f,13.0f}))
-  {
-    orange.tpTo(11.0f,13.0f,LEFT);
-  }
-  else if (red.draw().pos ==  CoordinatesF({13.0f,13.0f}))
-  {
-    red.tpTo(11.0F,13.0f,LEFT);
-  }
+  int input = con.getDirection();
+  if (input != NEUTRAL) idleFrames = 0;
+  else if (!attractMode()) idleFrames++;
 
+  // nobody at the controls: let the autopilot play
+  if (attractMode()) input = autopilotDirection(pacCore);
+
+  // all the rules live in the core; it only needs the input
+  pacCore.step(input);
 }
 
 // draw dynamic game elements
 // and update UI as needed
 void draw() {
+  // a new level's maze was drawn as it loaded, right over the shapes;
+  // only the door is left
+  if (pacCore.levelChanged) {
+    DrawMap::drawGhostDoor(&tft);
+    pacShapeP->forget();
+    redShapeP->forget();
+    blueShapeP->forget();
+    pinkShapeP->forget();
+    orangeShapeP->forget();
+    pacCore.levelChanged = false;
+  }
+
+  updateCamera();
   drawPacMan();
   drawGhosts();
 
@@ -382,18 +388,20 @@ bool running() {
   // check for game over
   if (game.isGameOver()) {
     // print winning or losing message
-    if (game.getScore() == Game::maxScore)
-      drawGameOver(true);
-    else  
-      drawGameOver(false);
+    drawGameOver(game.hasWon());
     
-    // click joystick to play again
-    while (!con.buttonTriggered()) {
-      if (digitalRead(BUTTON_PIN) == LOW) {
-        return false;  // Signal to exit
+    // click joystick to play again (attract mode just starts over)
+    if (attractMode()) {
+      delay(Game::deathDelay);
+    }
+    else {
+      while (!con.buttonTriggered()) {
+        if (digitalRead(BUTTON_PIN) == LOW) {
+          return false;  // Signal to exit
+        }
       }
-    } 
-    restart();
+    }
+    playAgain();
   }
 
   delay(FRAME_DELAY); // maintain upper bound to frame rate
@@ -7,9 +7,8 @@
 /*Track state of game map*/
 #ifndef MAPDATA_H
 #define MAPDATA_H
-#include <Arduino.h>
+#include "../platform.h"
 #include "gameConfig.h"
-#include "cleanMap.h"
 
 // describe map state with an instance of this class.
 struct MapData
@@ -23,26 +22,94 @@ struct MapData
         nonPlayArea = 4 // same color as bare path (e.g. inside ghost box)
     } mapStates;
 
-    // initialize with a clean map layout
+    // start with an empty map; loadLevel() fills in a maze
     MapData()
     {
-        initMapLayout();
+        resize(0, 0);
     }
 
-    // 2D map of tiles
-    uint8_t mapLayout[Y_BOUND][X_BOUND] = {};
+    // size of the loaded maze in tiles (at most Y_BOUND by X_BOUND).
+    // Tiles are indexed row * X_BOUND + col whatever the size.
+    uint8_t rows, cols;
 
-    // set all map tiles to their default state specified by blankMap
-    void initMapLayout()
+    // Per tile: what it is (2 bits) and whether its dot or pellet is still
+    // there (1 bit).
+    uint8_t kinds[(Y_BOUND * X_BOUND + 3) / 4];
+    uint8_t pickups[(Y_BOUND * X_BOUND + 7) / 8];
+
+    // the loaded level's exit masks in flash, 4 bits per tile indexed
+    // row * cols + col (see level.h), or 0 before a level is loaded
+    const uint8_t *exitMasks;
+
+    // the loaded level's junction graph and next-hop table in flash (see
+    // level.h), 0 before a level is loaded or for a maze without a table
+    const uint8_t *junctions;
+    const uint8_t *nextHops;
+
+    // dots and pellets not yet eaten
+    uint16_t pickupsLeft = 0;
+
+    // current state of a tile (wall outside the map)
+    uint8_t tileAt(int16_t r, int16_t c) const
+    {
+        if (r < 0 || r >= rows || c < 0 || c >= cols) return wall;
+        uint16_t i = r * X_BOUND + c;
+        uint8_t kind = (kinds[i >> 2] >> (2 * (i & 3))) & 3;
+        if (kind == kindWall) return wall;
+        if (kind == kindNonPlay) return nonPlayArea;
+        if (!(pickups[i >> 3] & (1 << (i & 7)))) return barePath;
+        return kind == kindPellet ? powerPellet : dot;
+    }
+
+    // directions (bit d for direction d, see exitMask.h) that lead onto
+    // a walkable tile, 0 if out of bounds. One flash read.
+    uint8_t exits(int16_t r, int16_t c) const
+    {
+        if (r < 0 || r >= rows || c < 0 || c >= cols || !exitMasks) return 0;
+        uint16_t i = r * cols + c;
+        return (pgm_read_byte(exitMasks + (i >> 1)) >> (4 * (i & 1))) & 0x0F;
+    }
+
+    // make every tile a wall with no pickup and set the maze size
+    void resize(uint8_t r, uint8_t c)
     {
-        for (int8_t r = 0; r < Y_BOUND; ++r)
-        {
-            // left half
-            for (int8_t c = 0; c < X_BOUND; ++c)
-            {
-                mapLayout[r][c] = blankMap[r][c];
-            }
-        }
+        memset(kinds, 0, sizeof kinds);
+        memset(pickups, 0, sizeof pickups);
+        exitMasks = 0;
+        junctions = nextHops = 0;
+        pickupsLeft = 0;
+        rows = r;
+        cols = c;
+    }
+
+    // set a tile to one of the mapStates
+    void setTile(int16_t r, int16_t c, uint8_t state)
+    {
+        uint16_t i = r * X_BOUND + c;
+        uint8_t kind = state == wall ? kindWall :
+                       state == nonPlayArea ? kindNonPlay :
+                       state == powerPellet ? kindPellet : kindPath;
+        uint8_t shift = 2 * (i & 3);
+        kinds[i >> 2] = (kinds[i >> 2] & ~(3 << shift)) | (kind << shift);
+
+        bool had = pickups[i >> 3] & (1 << (i & 7));
+        bool has = state == dot || state == powerPellet;
+        if (has) pickups[i >> 3] |= 1 << (i & 7);
+        else pickups[i >> 3] &= ~(1 << (i & 7));
+        pickupsLeft += has - had;
     }
+
+    // remove the dot or pellet on a tile
+    void clearPickup(int16_t r, int16_t c)
+    {
+        uint16_t i = r * X_BOUND + c;
+        if (!(pickups[i >> 3] & (1 << (i & 7)))) return;
+        pickups[i >> 3] &= ~(1 << (i & 7));
+        pickupsLeft--;
+    }
+
+  private:
+    // what a tile is, apart from its pickup
+    enum { kindWall, kindNonPlay, kindPath, kindPellet };
 };
 #endif
\ No newline at end of file
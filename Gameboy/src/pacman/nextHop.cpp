@@ -0,0 +1,35 @@
+/*Precomputed shortest-path directions for ghost movement*/
+#include "nextHop.h"
+#include "junctionGraph.h"
+#include "controller.h"
+
+int nextHopDirection(const MapData &map, int16_t srcRow, int16_t srcCol,
+                     int16_t destRow, int16_t destCol)
+{
+    if (!map.nextHops) {
+        return junctionRoute(map, srcRow, srcCol, destRow, destCol);
+    }
+    uint8_t dest = map.tileAt(destRow, destCol);
+    if (dest == MapData::wall || dest == MapData::nonPlayArea)
+        return NEUTRAL;
+    if (srcRow == destRow && srcCol == destCol)
+        return NEUTRAL;
+    uint8_t s = junctionAt(map, srcRow, srcCol);
+    if (s == JG_NO_NODE)
+        return NEUTRAL;
+
+    // the destination's column: walkable tiles before its row, plus
+    // those before it on the row
+    const uint8_t *rowStart = map.nextHops + 1 + 2 * destRow;
+    uint16_t t = pgm_read_byte(rowStart) | (pgm_read_byte(rowStart + 1) << 8);
+    for (int16_t c = 0; c < destCol; c++) {
+        uint8_t tile = map.tileAt(destRow, c);
+        t += tile != MapData::wall && tile != MapData::nonPlayArea;
+    }
+
+    // four 2-bit entries per byte
+    uint8_t rowBytes = pgm_read_byte(map.nextHops);
+    const uint8_t *row = map.nextHops + 1 + 2 * map.rows + s * rowBytes;
+    uint8_t packed = pgm_read_byte(row + (t >> 2));
+    return (packed >> (2 * (t & 3))) & 3;
+}
@@ -0,0 +1,18 @@
+/*Precomputed shortest-path directions for ghost movement*/
+#ifndef NEXTHOP_H
+#define NEXTHOP_H
+#include "../platform.h"
+#include "mapData.h"
+
+// Look up the first direction (UP, RIGHT, LEFT or DOWN) of a shortest path
+// from a junction tile (junctionGraph.h) to any walkable tile.
+// host/pack_levels.cpp stores the answer for every pair, 2 bits each, with
+// levels whose table fits LEVEL_NEXT_HOP_BUDGET (level.h); bigger mazes
+// search the junction graph instead.
+// Returns NEUTRAL if the source is not a junction, the destination is
+// not walkable, or both are the same tile.
+// Runtime complexity: O(log V + cols) with a table, O(V^2) without
+// (V junctions)
+int nextHopDirection(const MapData &map, int16_t srcRow, int16_t srcCol,
+                     int16_t destRow, int16_t destCol);
+#endif
@@ -6,85 +6,54 @@
 /^---------------------------------------------------------------------------*/
 /*Track state of pac-man actor.*/
 #include "pacMan.h"
-#include "global.h"
+#include "controller.h"
+#include "exitMask.h"
 
 PacMan::PacMan()
 {
 
-    obj.pos.x = 11.0f;  // Col (centered)
-    obj.pos.y = 18.0f;  // Row (near bottom)
+    obj.pos.x = 11 * SUBTILE;  // Col (centered)
+    obj.pos.y = 18 * SUBTILE;  // Row (near bottom)
     obj.dir = LEFT;     // Starting direction
-    obj.speed = 0.2;  // Do everything wrt having things sum to 1.0 nice
+    obj.speed = SUBTILE / 5;  // 1/5 tile per frame
     dirQue = LEFT;      // Queue up turning left (The queue can be overwritten)
 }
 
-// check that given tile is a valid area for pac-man to move
-bool PacMan::isValid(int row, int col)
-{
-    // Check if a given row/col is a valid tile for walking on
-    int tile = myMap.mapLayout[row][col];
-    return (tile != MapData::wall && tile != MapData::nonPlayArea);
-}
-
 // Modifies pac-man state for movement, power-pellet consumption, or
 // dot consumption.
-void PacMan::action()
+void PacMan::action(int inDir, MapData &map, Game &game)
 {
-    // Process pacmans actions
-    int inDir = con.getDirection(); // Read the controllers input
-    float col = obj.pos.x;  // Read pacmans x/col pos
-    float row = obj.pos.y;  // Read pacmans y/row pos
-
     if (inDir != NEUTRAL)
     {   
         // When the stick is being used get its direction
         dirQue = inDir;
     }
 
-    if (millis() - powerTimeStart >= powerTimeDuration) {
+    if (powerTicksLeft == 0) {
         // Check if pacman should no longer be powerfull
         powerful = 0;
     }
     else
     {
         // Waiting for pacman to lose his power/ unable to eat ghosts
+        powerTicksLeft--;
         powerful = 2;
     }
     // check if pac-man is in the centre of a tile
     if (isWhole(obj.pos.x) && isWhole(obj.pos.y))
     {   
+        int16_t row = near(obj.pos.y), col = near(obj.pos.x);
+
+        uint8_t exits = map.exits(row, col);
+
         // try moving in the requested direction
-        switch (dirQue)
+        if (hasExit(exits, dirQue))
         {
-        case UP:
-            if (isValid(near(row)-1, near(col))) // If the space is useable
-            {
-                obj.dir = UP;
-            }
-            break;
-        case DOWN:
-            if (isValid(near(row)+1, near(col))) // If the space is useable
-            {
-                obj.dir = DOWN;
-            }
-            break;
-        case LEFT:
-            if (isValid(near(row), near(col)-1)) // If the space is useable
-            {
-                obj.dir = LEFT;
-            }
-            break;
-        case RIGHT:
-            if (isValid(near(row), near(col)+1)) // If the space is useable
-            {
-                obj.dir = RIGHT;
-            }
-            break;
+            obj.dir = dirQue;
         }
 
         // update score if pac-man has landed on a power pellet or dot
-        int16_t row = near(obj.pos.y), col = near(obj.pos.x);
-        int8_t tileVal = myMap.mapLayout[row][col];
+        int8_t tileVal = map.tileAt(row, col);
         if (tileVal == MapData::dot || tileVal == MapData::powerPellet) {
             
             if (tileVal == MapData::dot)
@@ -93,60 +62,23 @@ void PacMan::action()
                 // TODO: increase speed temporarily and frighten ghosts
                 game.increaseScore(5);
                 powerful = 1;
-                powerTimeStart = millis();
+                powerTicksLeft = powerDuration;
             }
             game.scoreChanged = true;
 
             // remove item from tile
-            myMap.mapLayout[row][col] = MapData::barePath;
+            map.clearPickup(row, col);
         }
 
-        // move pac-man in the current direction
-        switch (obj.dir)
+        // move pac-man in the current direction (stop at a wall)
+        if (hasExit(exits, obj.dir))
         {
-        case UP:
-            if (isValid(near(row)-1, near(col))) // If the space is useable
-            {
-                obj.pos.y -= obj.speed;
-            }
-            break;
-        case DOWN:
-            if (isValid(near(row)+1, near(col))) // If the space is useable
-            {
-                obj.pos.y += obj.speed;
-            }
-            break;
-        case LEFT:
-            if (isValid(near(row), near(col)-1)) // If the space is useable
-            {
-                obj.pos.x -= obj.speed;
-            }
-            break;
-        case RIGHT:
-            if (isValid(near(row), near(col)+1)) // If the space is useable
-            {
-                obj.pos.x += obj.speed;
-            }
-            break;
+            moveForward();
         }
     }
     else
     {
-        switch (obj.dir)
-        {
-        /* Move forward/in the objects direction */
-        case UP:
-            obj.pos.y -= obj.speed;
-            break;
-        case DOWN:
-            obj.pos.y += obj.speed;
-            break;
-        case LEFT:
-            obj.pos.x -= obj.speed;
-            break;
-        case RIGHT:
-            obj.pos.x += obj.speed;
-            break;
-        }
+        // between tiles: keep going
+        moveForward();
     }
 }
@@ -7,30 +7,33 @@
 /*Track state of pac-man actor.*/
 #ifndef PACMAN_H
 #define PACMAN_H
-#include <Arduino.h>
+#include "../platform.h"
 #include "actor.h"
 #include "coordinates.h"
+#include "mapData.h"
+#include "game.h"
 
 // Pac-man state is described by an instance of this class.
 class PacMan: public Actor
 {
     private:
         int dirQue;
-        bool isValid(int row, int col);
     public:
         // default ctor. 
         // Initializes pac-man in default position and orientation.
         PacMan();
 
-        // Move around in the game world.
-        void action();
+        // Move around in the game world for one frame, steering towards
+        // inDir (NEUTRAL keeps the queued turn). Eats from map and scores
+        // into game.
+        void action(int inDir, MapData &map, Game &game);
 
         // State changes when pac-man has consumed a power pellet.
         // 0 when weak, 1 when start strong, 2 while waiting
-        int powerful; 
+        int powerful = 0;
 
-        unsigned long powerTimeStart; // use with millis() for power duration
-        static const unsigned long powerTimeDuration = 6000; // in milliseconds
+        uint16_t powerTicksLeft = 0; // frames of power remaining
+        uint16_t powerDuration = 0;  // frames a power pellet lasts
 };
 
 #endif
\ No newline at end of file
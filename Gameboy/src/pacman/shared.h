@@ -15,11 +15,11 @@
 #include <SPI.h>				            // must include this here (or else IDE can't find it)
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7735.h>		        // AF: Hardware-specific library
-#include "cleanMap.h"
 #include "gameConfig.h"
 #include "coordinates.h"
 #include "global.h"
 #include "mapData.h"
+#include "sprites.h"
 
 /// struct and class definitions
 
@@ -55,9 +55,6 @@ struct InfoBarData {
 
 // contains properties of game map
 struct DrawMap {
-  static const int8_t mapWidth = X_BOUND; // map width in tiles
-  static const int8_t mapHeight = Y_BOUND; // map height in tiles
-
   static const int8_t tileSize = SCALE; // size in pixels
   static const int8_t dotSize = SCALE/4; // 1/4 of tile size
   static const int8_t pelletSize = SCALE/2; // 1/2 tile size
@@ -70,13 +67,34 @@ struct DrawMap {
   static const int16_t pathColor = ST7735_BLACK; // color of paths, etc.
   static const int16_t dotColor = ST7735_WHITE; // color of dot pickups
   static const int16_t pelletColor = ST7735_WHITE; // color of power pellets
-  
-  // top left corner of the map (in pixels) - CENTERED
-  static const int16_t mapStartX = (Display::width - (mapWidth * tileSize)) / 2;
-  static const int16_t mapStartY = FONT_HEIGHT + 4 + ((Display::height - FONT_HEIGHT*2 - (mapHeight * tileSize)) / 2);
 
-  // draw map foreground to tft screen
-  static void drawMap(Adafruit_ST7735 * tft);
+  // part of the maze on screen (in tiles). Mazes taller than VIEW_ROWS
+  // show a window that starts at map row cameraRow.
+  static int8_t viewRows;
+  static int8_t viewCols;
+  static int8_t cameraRow;
+  
+  // top left corner of the visible map (in pixels) - CENTERED
+  static int16_t mapStartX;
+  static int16_t mapStartY;
+
+  // size the view for a rows x cols maze (clearing the old one if it
+  // was a different size) and put focusRow in the middle
+  static void fitLevel(Adafruit_ST7735 * tft, int8_t rows, int8_t cols, 
+    int16_t focusRow);
+
+  // camera row that keeps focusRow at least CAMERA_MARGIN rows from
+  // the top and bottom of the view. Stays put while it already does.
+  static int8_t cameraFor(int16_t focusRow, int8_t rows);
+
+  // screen position (in pixels) of a map tile
+  static int16_t tileX(int16_t c) { return mapStartX + c*tileSize; }
+  static int16_t tileY(int16_t r) { return mapStartY + (r - cameraRow)*tileSize; }
+
+  // check if a map row is on screen
+  static bool rowVisible(int16_t r) {
+    return r >= cameraRow && r < cameraRow + viewRows;
+  }
 
   // draw path or non-playable area (same color)
   static void drawPath(Adafruit_ST7735 * tft, uint16_t x, uint16_t y);
@@ -87,21 +105,25 @@ struct DrawMap {
   // draw power pellet (large pickup) on tft screen
   static void drawPowerPellet(Adafruit_ST7735 * tft, uint16_t x, uint16_t y);
 
-  // draw white "door" on ghost box
-  static void drawGhostDoor(Adafruit_ST7735 * tft, uint16_t x, uint16_t y);
+  // draw white "door" on top of the current level's ghost house
+  static void drawGhostDoor(Adafruit_ST7735 * tft);
 
+  // draw one map tile (walls included) from its current state,
+  // if it's on screen
   static void drawTile(Adafruit_ST7735 * tft, int8_t r, int8_t c);
+
+  // color the map shows at screen pixel (x, y)
+  static uint16_t pixelAt(int16_t x, int16_t y);
+
+  // fill the w x h window at (x, y) (at most SPRITE_SIZE + 2 square)
+  // with the map and a sprite frame with its top left at spritePos on
+  // top, in one go
+  static void drawOver(Adafruit_ST7735 * tft, int16_t x, int16_t y, 
+    int16_t w, int16_t h, Coordinates spritePos, uint16_t frame, int16_t col);
 };
 
 // contains properties for ghosts
 struct GhostData {
-  // start Red on top of ghost house
-  static const Coordinates redInitialPos;
-  // the other ghosts are in the ghost house initially
-  static const Coordinates blueInitialPos;
-  static const Coordinates pinkInitialPos;
-  static const Coordinates orangeInitialPos; 
-
   // ghost colors
   static const int16_t redColor = ST7735_RED;
   static const int16_t blueColor = ST7735_CYAN;
@@ -109,77 +131,152 @@ struct GhostData {
   static const int16_t orangeColor = ST7735_ORANGE;
   static const int16_t panickedColor = ST7735_LIGHTBLUE;
 
-  // ghost house stuff
+  // ghost house stuff (position comes from the level)
   static const int16_t ghostDoorColor = ST7735_WHITE;
-  static const int8_t  ghostDoorWidth = 2; // width in tiles
-  static const int8_t  ghostDoorCol = 14; // 0-based tile position
-  static const int8_t  ghostDoorRow = 16; // 0-based tile position
 };
 
-// base class for shapes that move in-game (ghosts and pac-man)
+// base class for shapes that move in-game (ghosts and pac-man).
+// Shapes are 1bpp sprites (see sprites.h) drawn over the map.
 class Shape {
   public:
-    // initialize in a given location with size and color
-    Shape(Coordinates pos, int16_t size, int16_t color) {
-      this->pos = pos;
-      this->size = size;
+    // initialize with the color its frames are drawn in
+    Shape(int16_t color) {
       this->color = color;
     };
 
-    // draw shape on touchscreen and fill previous location 
-    // with display bg color
-    void drawShape(Adafruit_ST7735 * tft) {
-      // draw shape in current position
-      tft->fillRect(lastPos.x, lastPos.y, size, size, Display::bgColor);
-      tft->fillRect(pos.x, pos.y, size, size, color);
-    };
+    // Draw frame (a word from sprites.h) in col at the current position
+    // and put the map back where the shape was drawn last. The old and
+    // new squares go out as a single window when they're close (a step
+    // is a pixel or two). Nothing is sent if the shape would look the
+    // same as it does now. Returns true if anything was drawn.
+    bool drawFrame(Adafruit_ST7735 * tft, uint16_t frame, int16_t col) {
+      bool moved = pos.x != lastPos.x || pos.y != lastPos.y;
+      if (!stale && !moved && frame == shownFrame && col == shownColor) {
+        return false;
+      }
 
-    // draw shape with custom color on-screen
-    void drawShape(Adafruit_ST7735 * tft, int16_t col) {
-      // draw shape in current position
-      tft->fillRect(lastPos.x, lastPos.y, size, size, Display::bgColor);
-      tft->fillRect(pos.x, pos.y, size, size, col);
-    };
+      int16_t left = min(pos.x, lastPos.x), top = min(pos.y, lastPos.y);
+      int16_t w = abs(pos.x - lastPos.x) + size;
+      int16_t h = abs(pos.y - lastPos.y) + size;
+      if (w <= SPRITE_SIZE + 2 && h <= SPRITE_SIZE + 2) {
+        DrawMap::drawOver(tft, left, top, w, h, pos, frame, col);
+      }
+      else {
+        // moved away (eaten, caught, let out of the house)
+        DrawMap::drawOver(tft, lastPos.x, lastPos.y, size, size, pos, 0, col);
+        DrawMap::drawOver(tft, pos.x, pos.y, size, size, pos, frame, col);
+      }
+      window = {left, top};
+      windowEnd = {int16_t(max(pos.x, lastPos.x) + size), 
+        int16_t(max(pos.y, lastPos.y) + size)};
+
+      lastPos = pos;
+      shownFrame = frame;
+      shownColor = col;
+      stale = false;
+      return true;
+    }
 
-    // save old position and update current position
+    // update current position (drawFrame() puts it on screen)
     void setPosition(Coordinates &newPos) {
-      this->lastPos = this->pos;
       this->pos = newPos;
     }
 
+    // put shape somewhere new without erasing the old position
+    // (e.g. the map has been redrawn underneath it)
+    void placeAt(Coordinates &newPos) {
+      this->lastPos = newPos;
+      this->pos = newPos;
+      hidden = false;
+      stale = true;
+    }
+
+    // put the map back under the shape and take it off the screen
+    void erase(Adafruit_ST7735 * tft) {
+      if (hidden) return;
+      DrawMap::drawOver(tft, lastPos.x, lastPos.y, size, size, lastPos, 0, 0);
+      window = lastPos;
+      windowEnd = {int16_t(lastPos.x + size), int16_t(lastPos.y + size)};
+      hidden = true;
+    }
+
+    // take shape off the screen without erasing it (the map has been
+    // redrawn underneath it)
+    void forget() {
+      hidden = true;
+    }
+
+    // make the next drawFrame() draw even if nothing changed (something
+    // else was drawn over the shape)
+    void invalidate() {
+      stale = true;
+    }
+
+    // check if the last window sent for other covered part of this
+    // shape as it is on screen
+    bool coveredBy(Shape &other) {
+      return !hidden && 
+        other.window.x < lastPos.x + size && lastPos.x < other.windowEnd.x &&
+        other.window.y < lastPos.y + size && lastPos.y < other.windowEnd.y;
+    }
+
+    // check if the shape must be placed before it's drawn
+    bool isHidden() {
+      return hidden;
+    }
+
+    // check if the shape (in pixels) would lie fully inside the map view
+    bool fitsView(Coordinates &p) {
+      return p.y >= DrawMap::mapStartY && 
+        p.y + size <= DrawMap::mapStartY + DrawMap::viewRows*DrawMap::tileSize;
+    }
+
   protected:
     Coordinates pos; // in pixels
-    Coordinates lastPos; // used for redrawing "trail" left behind
-    // Coordinates velocity; // in pixels
-    int8_t size; // all Dynamic shapes are squares of length "size"
+    Coordinates lastPos; // where it's on screen now (if not hidden)
+    Coordinates window, windowEnd; // last area drawn, for coveredBy()
+    static const int8_t size = SPRITE_SIZE; // all shapes are square
     int16_t color;
+    bool hidden = true; // not on screen; place before drawing
+    bool stale = true; // needs drawing even if it looks the same
+    uint16_t shownFrame = 0;
+    int16_t shownColor = 0;
 };
 
 // tracks shape of player character Pac-Man
+// (placed on screen by the renderer before it's first drawn)
 class PacManShape : public Shape {
   public:
-    PacManShape() : Shape(
-      {11*SCALE + DrawMap::mapStartX + 1, 18*SCALE + DrawMap::mapStartY + 1}, 
-      SCALE-2, 
-      ST7735_YELLOW) {};
+    PacManShape() : Shape(ST7735_YELLOW) {};
+
+    // draw pac-man facing dir, mouth open or shut
+    bool drawPacMan(Adafruit_ST7735 * tft, int8_t dir, bool open) {
+      uint8_t i = open && dir >= 0 && dir < PAC_SHUT ? dir : PAC_SHUT;
+      return drawFrame(tft, pgm_read_word(&pacFrames[i]), color);
+    }
 };
 
 // tracks shape of ghosts
 class GhostShape : public Shape {
   public:
-    // user must provide initial position and color for a ghost
-    GhostShape(Coordinates pos, int16_t color) : Shape(pos, SCALE-2,
-    color) {};
+    // user must provide color for a ghost
+    GhostShape(int16_t color) : Shape(color) {};
+
+    // draw ghost in its own color (skirt is 0 or 1). Like the others,
+    // returns true if anything was drawn
+    bool drawGhost(Adafruit_ST7735 * tft, uint8_t skirt) {
+      return drawFrame(tft, pgm_read_word(&ghostFrames[skirt]), color);
+    }
 
     // draw panicked ghost
-    void drawPanickedGhost(Adafruit_ST7735 * tft) {
-      drawShape(tft, panickedColor);
+    bool drawPanickedGhost(Adafruit_ST7735 * tft, uint8_t skirt) {
+      return drawFrame(tft, pgm_read_word(&frightenedFrames[skirt]), panickedColor);
     };
 
     // draw ghost with alternating colors to signal transition back to normal
-    void drawTogglingGhost(Adafruit_ST7735 * tft) {
-      if (!frightenedToggle) drawShape(tft, panickedColor);
-      else drawShape(tft, color);
+    bool drawTogglingGhost(Adafruit_ST7735 * tft, uint8_t skirt) {
+      return drawFrame(tft, pgm_read_word(&frightenedFrames[skirt]), 
+        frightenedToggle ? color : panickedColor);
     }
 
     // toggle to draw panicked ghost
@@ -263,14 +360,41 @@ class LivesBar {
   { InfoBarData::bottomBarLabelPos.x + Display::width/3, 
     InfoBarData::bottomBarLabelPos.y};
 
-/* static */ const Coordinates GhostData::redInitialPos = {
-  10*SCALE + DrawMap::mapStartX + 1, 10*SCALE + DrawMap::mapStartY + 1};
-/* static */ const Coordinates GhostData::blueInitialPos = {
-  10*SCALE + DrawMap::mapStartX + 1, 11*SCALE + DrawMap::mapStartY + 1};
-/* static */ const Coordinates GhostData::pinkInitialPos = {
-  13*SCALE + DrawMap::mapStartX + 1, 11*SCALE + DrawMap::mapStartY + 1};
-/* static */ const Coordinates GhostData::orangeInitialPos = {
-  12*SCALE + DrawMap::mapStartX + 1, 10*SCALE + DrawMap::mapStartY + 1};
+/* static */ int8_t DrawMap::viewRows = 0;
+/* static */ int8_t DrawMap::viewCols = 0;
+/* static */ int8_t DrawMap::cameraRow = 0;
+/* static */ int16_t DrawMap::mapStartX = 0;
+/* static */ int16_t DrawMap::mapStartY = 0;
+
+/* static */ void DrawMap::fitLevel(Adafruit_ST7735 * tft, int8_t rows, 
+  int8_t cols, int16_t focusRow) {
+  int8_t newRows = rows < VIEW_ROWS ? rows : VIEW_ROWS;
+  if (newRows != viewRows || cols != viewCols) {
+    tft->fillRect(mapStartX, mapStartY, viewCols*tileSize, viewRows*tileSize, 
+      Display::bgColor);
+  }
+  viewRows = newRows;
+  viewCols = cols;
+  mapStartX = (Display::width - (viewCols * tileSize)) / 2;
+  mapStartY = FONT_HEIGHT + 4 + ((Display::height - FONT_HEIGHT*2 - (viewRows * tileSize)) / 2);
+
+  // centre the camera on focusRow
+  cameraRow = focusRow - viewRows/2;
+  if (cameraRow > rows - viewRows) cameraRow = rows - viewRows;
+  if (cameraRow < 0) cameraRow = 0;
+}
+
+/* static */ int8_t DrawMap::cameraFor(int16_t focusRow, int8_t rows) {
+  int16_t top = cameraRow;
+  if (focusRow - top < CAMERA_MARGIN || 
+      top + viewRows - 1 - focusRow < CAMERA_MARGIN) {
+    // jump far enough to recentre, so the camera moves rarely
+    top = focusRow - viewRows/2;
+  }
+  if (top > rows - viewRows) top = rows - viewRows;
+  if (top < 0) top = 0;
+  return top;
+}
 
 /* static */ void DrawMap::drawPath(Adafruit_ST7735 * tft, uint16_t x, 
   uint16_t y) {
@@ -298,52 +422,104 @@ class LivesBar {
 }
 
 
-/* static */ void DrawMap::drawGhostDoor(Adafruit_ST7735 * tft, uint16_t x, 
-  uint16_t y) {
-  tft->drawFastHLine(x, y, GhostData::ghostDoorWidth*tileSize, 
-  GhostData::ghostDoorColor);
+/* static */ void DrawMap::drawGhostDoor(Adafruit_ST7735 * tft) {
+  const LevelLayout &l = pacCore.layout;
+  if (!rowVisible(l.houseTop)) return;
+  tft->drawFastHLine(tileX(l.doorCol), tileY(l.houseTop), 
+    l.doorWidth*tileSize, GhostData::ghostDoorColor);
 }
 
 
 /* static */void DrawMap::drawTile(Adafruit_ST7735 * tft, int8_t r, 
   int8_t c) {
-    switch (myMap.mapLayout[r][c]) {
+    if (!rowVisible(r)) return;
+    int16_t x = tileX(c);
+    int16_t y = tileY(r);
+
+    switch (myMap.tileAt(r, c)) {
+        case MapData::wall:
+          tft->fillRect(x, y, tileSize, tileSize, bgColor);
+          break;
+
         case MapData::barePath: // draw same color in both cases
         case MapData::nonPlayArea:
-          drawPath(tft, mapStartX + c*tileSize, 
-              mapStartY + r*tileSize);
+          drawPath(tft, x, y);
           break;
 
         case MapData::dot: // draw dot on tile
-          drawPath(tft, mapStartX + c*tileSize, 
-              mapStartY + r*tileSize);
-          drawDot(tft, mapStartX + c*tileSize, 
-              mapStartY + r*tileSize);
+          drawPath(tft, x, y);
+          drawDot(tft, x, y);
           break;
 
         case MapData::powerPellet: // draw power pellet on tile 
-          drawPath(tft, mapStartX + c*tileSize, 
-              mapStartY + r*tileSize);
-          drawPowerPellet(tft, mapStartX + c*tileSize, 
-              mapStartY + r*tileSize);
+          drawPath(tft, x, y);
+          drawPowerPellet(tft, x, y);
           break;
       }
   }
 
-/* static  */void DrawMap::drawMap(Adafruit_ST7735 * tft) {
-  // fill background
-  tft->fillRect(mapStartX, mapStartY, mapWidth*tileSize, mapHeight*tileSize, 
-    bgColor);
-  
-  for (int8_t r = 0; r < mapHeight; ++r) {
-    // left half
-    for (int8_t c = 0; c < mapWidth; ++c) {
-      drawTile(tft,r,c);
+/* static */ uint16_t DrawMap::pixelAt(int16_t x, int16_t y) {
+  int16_t dx = x - mapStartX;
+  int16_t dy = y - mapStartY;
+  if (dx < 0 || dy < 0 || dx >= viewCols*tileSize || dy >= viewRows*tileSize) {
+    return Display::bgColor;
+  }
+  int16_t r = dy/tileSize + cameraRow;
+  int16_t c = dx/tileSize;
+  dx %= tileSize;
+  dy %= tileSize;
+
+  const LevelLayout &l = pacCore.layout;
+  if (r == l.houseTop && dy == 0 && c >= l.doorCol && 
+      c < l.doorCol + l.doorWidth) {
+    return GhostData::ghostDoorColor;
+  }
+
+  switch (myMap.tileAt(r, c)) {
+    case MapData::wall:
+      return bgColor;
+
+    case MapData::dot:
+      if (dx >= dotOffset && dx < dotOffset + dotSize &&
+          dy >= dotOffset && dy < dotOffset + dotSize) return dotColor;
+      return pathColor;
+
+    case MapData::powerPellet:
+      if (dx >= pelletXOffset && dx < pelletXOffset + pelletSize &&
+          dy >= pelletYOffset && dy < pelletYOffset + pelletSize) {
+        return pelletColor;
+      }
+      return pathColor;
+
+    default:
+      return pathColor;
+  }
+}
+
+/* static */ void DrawMap::drawOver(Adafruit_ST7735 * tft, int16_t x, 
+  int16_t y, int16_t w, int16_t h, Coordinates spritePos, uint16_t frame, 
+  int16_t col) {
+  uint16_t pixels[(SPRITE_SIZE + 2) * (SPRITE_SIZE + 2)];
+  uint8_t n = 0;
+  for (int16_t py = y; py < y + h; py++) {
+    for (int16_t px = x; px < x + w; px++) {
+      int16_t sx = px - spritePos.x;
+      int16_t sy = py - spritePos.y;
+      bool inSprite = sx >= 0 && sx < SPRITE_SIZE && sy >= 0 && sy < SPRITE_SIZE;
+      if (inSprite && (frame & (0x8000 >> (sy*SPRITE_SIZE + sx)))) {
+        pixels[n++] = col;
+      }
+      else {
+        pixels[n++] = pixelAt(px, py);
+      }
     }
   }
 
-  // draw ghost door
-  drawGhostDoor(tft, GhostData::ghostDoorCol*tileSize, 
-    GhostData::ghostDoorRow*tileSize);
-};
+  // one address window for the lot instead of a fillRect per color
+  tft->startWrite();
+  tft->setAddrWindow(x, y, w, h);
+  tft->writePixels(pixels, n);
+  tft->endWrite();
+}
+
 #endif
@@ -0,0 +1,35 @@
+/*1bpp animation frames for Pac-Man and the ghosts*/
+#ifndef SPRITES_H
+#define SPRITES_H
+#include "../platform.h"
+
+// Sprites are one tile (SPRITE_SIZE x SPRITE_SIZE pixels). A frame is
+// one word: row 0 in the top nibble, each row's leftmost pixel in the
+// nibble's top bit. Set bits are drawn in the actor's color, clear bits
+// show the map underneath.
+#define SPRITE_SIZE 4
+
+// Pac-Man with his mouth open, indexed by direction (UP, RIGHT, LEFT,
+// DOWN), then with it shut
+#define PAC_SHUT 4
+static const uint16_t pacFrames[5] PROGMEM = {
+  0x09F6, // ..../#..#/####/.##.
+  0x6CC6, // .##./##../##../.##.
+  0x6336, // .##./..##/..##/.##.
+  0x6F90, // .##./####/#..#/....
+  0x6FF6, // .##./####/####/.##.
+};
+
+// ghosts, two skirt frames each
+static const uint16_t ghostFrames[2] PROGMEM = {
+  0x6FFA, // .##./####/####/#.#.
+  0x6FF5, // .##./####/####/.#.#
+};
+
+// frightened ghosts: the same, with eyes cut out
+static const uint16_t frightenedFrames[2] PROGMEM = {
+  0x69FA, // .##./#..#/####/#.#.
+  0x69F5, // .##./#..#/####/.#.#
+};
+
+#endif
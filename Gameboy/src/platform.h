@@ -0,0 +1,18 @@
+/* Lets game logic build both for the Arduino and for desktop host tools. */
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+// host builds keep "flash" tables in ordinary memory
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#endif
+
+#endif
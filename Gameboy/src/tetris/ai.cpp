@@ -0,0 +1,144 @@
+/*Computer player for Tetris (attract mode and unattended runs)*/
+#include "ai.h"
+#include "pieces.h"
+
+// mask moved up and left until it touches the top and left edges, so
+// rotations that only differ by where they sit in the box compare equal
+static uint16_t normalized(uint16_t mask)
+{
+    while (!(mask & 0x000F)) mask >>= 4;
+    while (!(mask & 0x1111)) mask >>= 1;
+    return mask;
+}
+
+static uint8_t bitCount(uint16_t v)
+{
+    uint8_t n = 0;
+    for (; v; v &= v - 1) n++;
+    return n;
+}
+
+int32_t aiScore(const Well &well, uint8_t lines, const AiWeights &weights)
+{
+    if (well.rows[0] || well.rows[1]) return AI_LOST;
+
+    int16_t height = 0, bumpiness = 0, holes = 0;
+    for (int8_t x = 0; x < WELL_WIDTH; x++) {
+        height += well.heights[x];
+        if (x > 0) bumpiness += abs(well.heights[x] - well.heights[x - 1]);
+    }
+
+    // an empty cell is a hole if any row above it has its column filled
+    uint16_t covered = 0;
+    for (int8_t y = 0; y < WELL_HEIGHT; y++) {
+        holes += bitCount(covered & ~well.rows[y]);
+        covered |= well.rows[y];
+    }
+
+    return (int32_t)weights.height * height +
+           (int32_t)weights.lines * lines +
+           (int32_t)weights.holes * holes +
+           (int32_t)weights.bumpiness * bumpiness;
+}
+
+// drop a piece into from, leaving the result in to; returns lines cleared
+static uint8_t drop(const Well &from, Well &to, uint8_t type,
+                    int8_t rotation, int8_t x)
+{
+    uint16_t shape = pieceMask(type, rotation);
+    to = from;
+    int8_t y = to.dropRow(shape, x, 0);
+    to.place(shape, x, y, type + 1);
+    return to.clearFullRows(y, y + SHAPE_ROWS - 1);
+}
+
+bool AiSearch::advance(Cursor &c, const Well &from)
+{
+    if (++c.x <= c.maxX) return true;
+
+    // next rotation that isn't the same shape as an earlier one, and
+    // that fits where pieces spawn
+    while (++c.rotation < ROTATIONS) {
+        uint16_t shape = pieceMask(c.type, c.rotation);
+        bool repeat = false;
+        for (int8_t r = 0; r < c.rotation; r++) {
+            if (normalized(pieceMask(c.type, r)) == normalized(shape)) repeat = true;
+        }
+        if (repeat || from.collides(shape, SPAWN_X, 0)) continue;
+
+        // columns it can slide to along the spawn row
+        c.x = SPAWN_X;
+        while (!from.collides(shape, c.x - 1, 0)) c.x--;
+        c.maxX = SPAWN_X;
+        while (!from.collides(shape, c.maxX + 1, 0)) c.maxX++;
+        return true;
+    }
+    return false;
+}
+
+void AiSearch::begin(const Well &well, uint8_t type, int8_t next,
+                     const AiWeights &weights)
+{
+    this->well = &well;
+    this->weights = weights;
+    lookahead = next != AI_NO_PIECE;
+    first.type = type;
+    first.rotation = -1;
+    first.x = first.maxX = 0;
+    second.type = lookahead ? next : 0;
+    inSecond = false;
+    placements = 0;
+
+    // nothing fits where pieces spawn: there's no placement to pick
+    done = !advance(first, well);
+    bestRotation = done ? -1 : first.rotation;
+    bestX = first.x;
+    bestScore = AI_LOST;
+}
+
+// the first placement has been tried with every second one
+void AiSearch::finishFirst()
+{
+    if (firstScore > bestScore) {
+        bestScore = firstScore;
+        bestRotation = first.rotation;
+        bestX = first.x;
+    }
+    inSecond = false;
+    if (!advance(first, *well)) done = true;
+}
+
+bool AiSearch::step(uint16_t budget)
+{
+    Well after;
+    for (; budget > 0 && !done; budget--) {
+        placements++;
+        if (inSecond) {
+            uint8_t lines = drop(firstWell, after, second.type,
+                                 second.rotation, second.x);
+            int32_t score = aiScore(after, firstLines + lines, weights);
+            if (score > firstScore) firstScore = score;
+            if (!advance(second, firstWell)) finishFirst();
+            continue;
+        }
+
+        firstLines = drop(*well, firstWell, first.type, first.rotation, first.x);
+        firstScore = aiScore(firstWell, firstLines, weights);
+
+        // look ahead unless this one already loses; if the next piece
+        // has nowhere to go, it loses
+        if (lookahead && firstScore != AI_LOST) {
+            second.rotation = -1;
+            second.maxX = 0;
+            second.x = 0;
+            if (advance(second, firstWell)) {
+                firstScore = AI_LOST;
+                inSecond = true;
+                continue;
+            }
+            firstScore = AI_LOST;
+        }
+        finishFirst();
+    }
+    return done;
+}
@@ -0,0 +1,82 @@
+/*Computer player for Tetris (attract mode and unattended runs)*/
+#ifndef AI_H
+#define AI_H
+#include "../platform.h"
+#include "well.h"
+#include "aiWeights.h"
+
+// placements one AiSearch::step() call on the console looks at
+#define AI_PLACEMENTS_PER_STEP 4
+
+// no next piece to look ahead to
+#define AI_NO_PIECE -1
+
+// score of a well that has topped out
+#define AI_LOST (-0x7FFFFFFFL)
+
+// What the player goes for, each weight times one property of the well
+// after a placement: total column height, lines cleared, holes (empty
+// cells with something above them) and bumpiness (sum of the height
+// steps between neighbouring columns).
+struct AiWeights {
+    int16_t height;
+    int16_t lines;
+    int16_t holes;
+    int16_t bumpiness;
+};
+
+static const AiWeights aiWeights = AI_WEIGHTS;
+
+// how good well is after clearing lines, higher is better
+int32_t aiScore(const Well &well, uint8_t lines, const AiWeights &weights);
+
+// Looks for the best place to drop a piece: every distinct rotation in
+// every column it can slide to from where it spawns, dropped straight
+// down. With a next piece it also tries every placement of that on each
+// result and keeps the best pair. The work is split into step() calls so
+// the game keeps running while it thinks.
+//
+// Placements come from the column heights (Well::dropRow), so one costs
+// a well copy, a place, a clear and a score. A search is about 25
+// placements, or about 550 looking ahead.
+struct AiSearch {
+    // set when a search has finished; best holds the answer, or
+    // bestRotation is -1 if the piece fits nowhere
+    bool done;
+    int8_t bestRotation;
+    int8_t bestX;
+    int32_t bestScore;
+    uint16_t placements;  // looked at so far
+
+    // start a search for type dropped into well, looking ahead to next
+    // (or AI_NO_PIECE). well mustn't change until the search is done.
+    void begin(const Well &well, uint8_t type, int8_t next,
+               const AiWeights &weights);
+
+    // look at up to budget more placements. Returns done.
+    bool step(uint16_t budget);
+
+private:
+    // where one piece of the pair is up to
+    struct Cursor {
+        uint8_t type;
+        int8_t rotation;
+        int8_t x;
+        int8_t maxX;
+    };
+
+    const Well *well;
+    AiWeights weights;
+    bool lookahead;
+    Cursor first, second;
+    bool inSecond;        // trying the next piece on firstWell
+    Well firstWell;       // well with the first piece dropped in
+    uint8_t firstLines;
+    int32_t firstScore;   // best score found for the first placement
+
+    // move c to its next placement on from; false when there are none
+    bool advance(Cursor &c, const Well &from);
+    void finishFirst();
+};
+
+#endif
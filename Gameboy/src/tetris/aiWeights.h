@@ -0,0 +1,9 @@
+/*Heuristic weights for the Tetris computer player*/
+#ifndef AI_WEIGHTS_H
+#define AI_WEIGHTS_H
+
+// { height, lines, holes, bumpiness } in thousandths, see AiWeights in
+// ai.h. Written by host/tetris_tune (10 generations of 200 games).
+#define AI_WEIGHTS { -619, 598, -458, -221 }
+
+#endif
@@ -0,0 +1,68 @@
+/*Tetris controls: timestamped input changes, delayed auto shift and auto repeat*/
+#include "controls.h"
+#include "well.h"
+
+void ControlQueue::reset(uint8_t state, unsigned long time)
+{
+    this->state = state;
+    head = count = 0;
+    for (uint8_t b = 0; b < CTL_BITS; b++) {
+        changedAt[b] = (uint16_t)(time - CTL_DEBOUNCE_MS);
+    }
+}
+
+void ControlQueue::sample(uint8_t state, unsigned long time)
+{
+    uint8_t changed = state ^ this->state;
+    for (uint8_t b = 0; b < CTL_BITS; b++) {
+        if (!(changed & (1 << b))) continue;
+        // too soon after its last change: leave it for a later sample
+        if ((uint16_t)((uint16_t)time - changedAt[b]) < CTL_DEBOUNCE_MS) {
+            changed &= ~(1 << b);
+        }
+        else {
+            changedAt[b] = (uint16_t)time;
+        }
+    }
+    if (!changed) return;
+    this->state ^= changed;
+
+    if (count == CTL_QUEUE) {
+        edges[(head + count - 1) % CTL_QUEUE].state = this->state;
+        return;
+    }
+    ControlEdge &edge = edges[(head + count) % CTL_QUEUE];
+    edge.state = this->state;
+    edge.time = time;
+    count++;
+}
+
+bool ControlQueue::next(ControlEdge &edge)
+{
+    if (!count) return false;
+    edge = edges[head];
+    head = (head + 1) % CTL_QUEUE;
+    count--;
+    return true;
+}
+
+bool AutoShift::hold(int8_t dir, unsigned long time)
+{
+    if (dir == this->dir) return false;
+    this->dir = dir;
+    nextMove = time + DAS_MS;
+    return dir != 0;
+}
+
+uint8_t AutoShift::due(unsigned long now)
+{
+    if (!dir || (long)(now - nextMove) < 0) return 0;
+#if ARR_MS == 0
+    nextMove = now;
+    return WELL_WIDTH;
+#else
+    unsigned long repeats = (now - nextMove) / ARR_MS + 1;
+    nextMove += repeats * ARR_MS;
+    return repeats < WELL_WIDTH ? repeats : WELL_WIDTH;
+#endif
+}
@@ -0,0 +1,69 @@
+/*Tetris controls: timestamped input changes, delayed auto shift and auto repeat*/
+#ifndef CONTROLS_H
+#define CONTROLS_H
+#include "../platform.h"
+
+// control bits, as one byte of state
+#define CTL_LEFT  0x01
+#define CTL_RIGHT 0x02
+#define CTL_SOFT  0x04   // soft drop
+#define CTL_DROP  0x08   // hard drop
+#define CTL_TURN  0x10
+#define CTL_BITS  5
+
+// Sideways moves: one on press, then after DAS_MS held one every ARR_MS
+// (0 slides straight to the wall)
+#define DAS_MS 167
+#define ARR_MS 33
+
+// a control has to stay put this long before another change counts
+// (button bounce, stick jitter at the threshold)
+#define CTL_DEBOUNCE_MS 8
+
+// changes kept between two handleControls() calls
+#define CTL_QUEUE 8
+
+struct ControlEdge {
+    uint8_t state;       // all controls after the change
+    unsigned long time;  // when it was sampled (ms)
+};
+
+// Control changes in the order they happened, each with the time it was
+// sampled. Sampling is cheap, so the game does it wherever it may spend
+// a while (drawing, the line clear flash) and acts on the changes later
+// with their real times.
+struct ControlQueue {
+    uint8_t state;  // as last sampled
+
+    // forget queued changes and start from state
+    void reset(uint8_t state, unsigned long time);
+
+    // record the controls as they are at time, if they changed. When
+    // the queue is full the change is merged into the newest entry.
+    void sample(uint8_t state, unsigned long time);
+
+    // take the oldest change; false if there is none
+    bool next(ControlEdge &edge);
+
+private:
+    ControlEdge edges[CTL_QUEUE];
+    uint8_t head, count;
+    uint16_t changedAt[CTL_BITS];  // low 16 bits of the time each bit last changed
+};
+
+// Delayed auto shift and auto repeat for the sideways moves, timed from
+// when the stick actually moved rather than from the game's own ticks.
+struct AutoShift {
+    int8_t dir;              // direction held: -1 left, 1 right, 0 none
+    unsigned long nextMove;  // when the next repeat is due
+
+    // the stick is held towards dir from time on. True if that's a new
+    // direction, which moves the piece once straight away.
+    bool hold(int8_t dir, unsigned long time);
+
+    // repeat moves that have come due by now; more than one if the
+    // game was busy for a while
+    uint8_t due(unsigned long now);
+};
+
+#endif
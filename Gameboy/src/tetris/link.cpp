@@ -0,0 +1,98 @@
+/*Framed binary link between two consoles over a serial port*/
+#include "link.h"
+
+// where the receiver is up to in a frame
+enum { RX_SYNC, RX_LENGTH, RX_SEQ, RX_TYPE, RX_PAYLOAD, RX_CRC };
+
+uint8_t crc8(uint8_t crc, uint8_t byte)
+{
+    crc ^= byte;
+    for (uint8_t i = 0; i < 8; i++) {
+        crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+    return crc;
+}
+
+void Link::reset()
+{
+    badFrames = lostFrames = 0;
+    txHead = txTail = txSeq = 0;
+    rxState = RX_SYNC;
+    rxSeen = false;
+}
+
+void Link::put(uint8_t byte)
+{
+    tx[txHead++ & (LINK_TX_BUFFER - 1)] = byte;
+}
+
+bool Link::send(uint8_t type, const uint8_t *payload, uint8_t length)
+{
+    if (length > LINK_MAX_PAYLOAD ||
+        LINK_TX_BUFFER - txPending() < LINK_HEADER + length + 1) return false;
+
+    uint8_t crc = crc8(0, length);
+    put(LINK_SYNC);
+    put(length);
+    crc = crc8(crc, txSeq);
+    put(txSeq++);
+    crc = crc8(crc, type);
+    put(type);
+    for (uint8_t i = 0; i < length; i++) {
+        crc = crc8(crc, payload[i]);
+        put(payload[i]);
+    }
+    put(crc);
+    return true;
+}
+
+bool Link::receive(uint8_t byte)
+{
+    switch (rxState) {
+    case RX_SYNC:
+        if (byte == LINK_SYNC) rxState = RX_LENGTH;
+        return false;
+
+    case RX_LENGTH:
+        if (byte > LINK_MAX_PAYLOAD) {
+            badFrames++;
+            rxState = byte == LINK_SYNC ? RX_LENGTH : RX_SYNC;
+            return false;
+        }
+        frame.length = byte;
+        rxCrc = crc8(0, byte);
+        rxState = RX_SEQ;
+        return false;
+
+    case RX_SEQ:
+        frame.seq = byte;
+        rxCrc = crc8(rxCrc, byte);
+        rxState = RX_TYPE;
+        return false;
+
+    case RX_TYPE:
+        frame.type = byte;
+        rxCrc = crc8(rxCrc, byte);
+        rxCount = 0;
+        rxState = frame.length ? RX_PAYLOAD : RX_CRC;
+        return false;
+
+    case RX_PAYLOAD:
+        frame.payload[rxCount++] = byte;
+        rxCrc = crc8(rxCrc, byte);
+        if (rxCount == frame.length) rxState = RX_CRC;
+        return false;
+
+    case RX_CRC:
+        rxState = RX_SYNC;
+        if (byte != rxCrc) {
+            badFrames++;
+            return false;
+        }
+        if (rxSeen) lostFrames += (uint8_t)(frame.seq - rxNextSeq);
+        rxSeen = true;
+        rxNextSeq = frame.seq + 1;
+        return true;
+    }
+    return false;
+}
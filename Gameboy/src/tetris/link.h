@@ -0,0 +1,69 @@
+/*Framed binary link between two consoles over a serial port*/
+#ifndef LINK_H
+#define LINK_H
+#include "../platform.h"
+
+// Frame layout, one byte each unless noted:
+//   SYNC  LEN  SEQ  TYPE  PAYLOAD (LEN bytes)  CRC
+// SEQ counts up by one per frame sent, so the other end can tell how
+// many went missing. CRC is CRC-8 (polynomial 0x07) over LEN..PAYLOAD.
+// A frame with a bad CRC or length is dropped and the receiver hunts
+// for the next SYNC.
+#define LINK_SYNC 0xA5
+#define LINK_HEADER 4          // SYNC, LEN, SEQ, TYPE
+#define LINK_MAX_PAYLOAD 24
+#define LINK_TX_BUFFER 64      // bytes; a power of two
+
+struct LinkFrame {
+    uint8_t type;
+    uint8_t seq;
+    uint8_t length;
+    uint8_t payload[LINK_MAX_PAYLOAD];
+};
+
+// Both directions of the link, with no I/O of its own: the caller feeds
+// it bytes as they arrive and takes bytes to send as the port has room,
+// so neither side ever waits on the other.
+struct Link {
+    LinkFrame frame;      // the last good frame receive() returned true for
+    uint16_t badFrames;   // dropped for a bad length or CRC
+    uint16_t lostFrames;  // gaps in the other end's sequence numbers
+
+    void reset();
+
+    // queue a whole frame to send. Returns false, queueing nothing, if
+    // it doesn't fit in what's left of the TX buffer.
+    bool send(uint8_t type, const uint8_t *payload, uint8_t length);
+
+    // bytes waiting to go out, and take the next one
+    uint8_t txPending() const
+    {
+        return (uint8_t)(txHead - txTail);
+    }
+    uint8_t txByte()
+    {
+        return tx[txTail++ & (LINK_TX_BUFFER - 1)];
+    }
+
+    // take one received byte. True when it completes a good frame (see
+    // frame).
+    bool receive(uint8_t byte);
+
+private:
+    uint8_t tx[LINK_TX_BUFFER];
+    uint8_t txHead, txTail;  // free-running; wrap at 256
+    uint8_t txSeq;
+
+    uint8_t rxState;
+    uint8_t rxCount;         // payload bytes read so far
+    uint8_t rxCrc;
+    bool rxSeen;             // a frame has arrived, so SEQ can be checked
+    uint8_t rxNextSeq;
+
+    void put(uint8_t byte);
+};
+
+// CRC-8, polynomial 0x07, of one more byte
+uint8_t crc8(uint8_t crc, uint8_t byte);
+
+#endif
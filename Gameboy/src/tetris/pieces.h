@@ -0,0 +1,83 @@
+/*Tetromino shapes and wall kicks (Super Rotation System)*/
+#ifndef PIECES_H
+#define PIECES_H
+#include "../platform.h"
+
+// piece types, in table order
+enum { PIECE_I, PIECE_J, PIECE_L, PIECE_O, PIECE_S, PIECE_T, PIECE_Z, PIECE_TYPES };
+
+// rotation states, turning clockwise: spawn, right, twice, left
+#define ROTATIONS 4
+
+// positions tried, in order, when a piece turns
+#define KICK_TESTS 5
+
+// column new pieces come in at (top left of their mask), the middle of
+// the well
+#define SPAWN_X 3
+
+// Shapes are 4x4 masks (see well.h). Each piece turns inside the top
+// left n x n box of its mask, 3 x 3 for J, L, S, T and Z and 4 x 4 for
+// I, as in SRS; O doesn't turn.
+
+// bit k of mask after a clockwise quarter turn in the n x n box: cell
+// (row k / 4, column k % 4) moves to (column, n - 1 - row)
+constexpr uint16_t turnedBit(uint16_t mask, uint8_t n, uint8_t k)
+{
+    return (mask >> k) & 1 ? 1 << (4 * (k & 3) + n - 1 - (k >> 2)) : 0;
+}
+
+constexpr uint16_t turnCW(uint16_t mask, uint8_t n, uint8_t k = 0)
+{
+    return k == 16 ? 0 : turnedBit(mask, n, k) | turnCW(mask, n, k + 1);
+}
+
+// all four rotation states from the spawn state, worked out when the
+// sketch compiles
+#define TURNS(spawn, n) { \
+    spawn, turnCW(spawn, n), turnCW(turnCW(spawn, n), n), \
+    turnCW(turnCW(turnCW(spawn, n), n), n) }
+
+static const uint16_t pieceMasks[PIECE_TYPES][ROTATIONS] PROGMEM = {
+    TURNS(0x00F0, 4),                   // I  ..../####
+    TURNS(0x0071, 3),                   // J  #.../###.
+    TURNS(0x0074, 3),                   // L  ..#./###.
+    {0x0066, 0x0066, 0x0066, 0x0066},   // O  .##./.##.
+    TURNS(0x0036, 3),                   // S  .##./##..
+    TURNS(0x0072, 3),                   // T  .#../###.
+    TURNS(0x0063, 3),                   // Z  ##../.##.
+};
+
+// SRS wall kicks for a clockwise turn out of each rotation state, as
+// (dx, dy) with y going down the well. The first one that fits wins.
+static const int8_t kicksJLSTZ[ROTATIONS][KICK_TESTS][2] PROGMEM = {
+    {{0, 0}, {-1, 0}, {-1, -1}, {0, 2}, {-1, 2}},   // 0 -> R
+    {{0, 0}, {1, 0}, {1, 1}, {0, -2}, {1, -2}},     // R -> 2
+    {{0, 0}, {1, 0}, {1, -1}, {0, 2}, {1, 2}},      // 2 -> L
+    {{0, 0}, {-1, 0}, {-1, 1}, {0, -2}, {-1, -2}},  // L -> 0
+};
+
+static const int8_t kicksI[ROTATIONS][KICK_TESTS][2] PROGMEM = {
+    {{0, 0}, {-2, 0}, {1, 0}, {-2, 1}, {1, -2}},    // 0 -> R
+    {{0, 0}, {-1, 0}, {2, 0}, {-1, -2}, {2, 1}},    // R -> 2
+    {{0, 0}, {2, 0}, {-1, 0}, {2, -1}, {-1, 2}},    // 2 -> L
+    {{0, 0}, {1, 0}, {-2, 0}, {1, 2}, {-2, -1}},    // L -> 0
+};
+
+// shape of a piece type in a rotation state
+static inline uint16_t pieceMask(uint8_t type, uint8_t rotation)
+{
+    return pgm_read_word(&pieceMasks[type][rotation]);
+}
+
+// offset of kick test for a clockwise turn of type out of rotation
+static inline void kickOffset(uint8_t type, uint8_t rotation, uint8_t test,
+                              int8_t &dx, int8_t &dy)
+{
+    const int8_t *kick = type == PIECE_I ? kicksI[rotation][test]
+                                         : kicksJLSTZ[rotation][test];
+    dx = (int8_t)pgm_read_byte(&kick[0]);
+    dy = (int8_t)pgm_read_byte(&kick[1]);
+}
+
+#endif
@@ -1,239 +1,249 @@
 #include "tetris.h"
 #include <Arduino.h>
+#include "well.h"
+#include "pieces.h"
+#include "ai.h"
+#include "controls.h"
+#include "versus.h"
 
 // Forward declarations 
-void checkLines();
-void breakLine(short line);
-void drawGrid();
-void erasePiece(short oldPiece[2][4], short oldX, short oldY);
+short clearLines();
+uint16_t cellColor(const Well &w, short x, short y);
+void drawChangedRows(const Well &before);
+void paintCell(short x, short y);
+void erasePiece(uint16_t oldPiece, short oldX, short oldY);
 void drawPiece(short type, short x, short y);
-boolean nextHorizontalCollision(short testPiece[2][4], int amount);
+boolean covers(uint16_t shape, short shapeX, short shapeY, short x, short y);
+void updateGhost();
+void lockPiece();
+void hardDrop();
+boolean nextHorizontalCollision(uint16_t testPiece, int amount);
 boolean nextCollision();
 boolean checkGameOver();
-void showGameOver();
+void showGameOver(boolean won);
 void resetGame();
 void generate();
 void drawNextPiece();
-void copyPiece(short piece[2][4], short type, short rotation);
-short getMaxRotation(short type);
-boolean canRotate(short rotation);
+boolean tryRotate();
 void updateScore();
 void drawLayout();
 void updatePiece();
-
-// Tetris piece definitions: [rotations][x,y coordinates][4 blocks per piece]
-const char pieces_S_l[2][2][4] = {{  // S-piece (left orientation)
-                                    {0, 0, 1, 1}, {0, 1, 1, 2}
-                                  },
-                                  {
-                                    {0, 1, 1, 2}, {1, 1, 0, 0}
-                                  }};
-
-const char pieces_S_r[2][2][4] = {{  // S-piece (right orientation)
-                                    {1, 1, 0, 0}, {0, 1, 1, 2}
-                                  },
-                                  {
-                                    {0, 1, 1, 2}, {0, 0, 1, 1}
-                                  }};
-
-const char pieces_L_l[4][2][4] = {{  // L-piece (left): 4 rotation states
-                                    {0, 0, 0, 1}, {0, 1, 2, 2}
-                                  },
-                                  {
-                                    {0, 1, 2, 2}, {1, 1, 1, 0}
-                                  },
-                                  {
-                                    {0, 1, 1, 1}, {0, 0, 1, 2}
-                                  },
-                                  {
-                                    {0, 0, 1, 2}, {1, 0, 0, 0}
-                                  }};
-
-const char pieces_Sq[1][2][4] = {{  // Square: no rotation needed
-                                    {0, 1, 0, 1}, {0, 0, 1, 1}
-                                  }};
-
-const char pieces_T[4][2][4] = {{   // T-piece: 4 rotation states
-                                    {0, 0, 1, 0}, {0, 1, 1, 2}
-                                  },
-                                  {
-                                    {0, 1, 1, 2}, {1, 0, 1, 1}
-                                  },
-                                  {
-                                    {1, 0, 1, 1}, {0, 1, 1, 2}
-                                  },
-                                  {
-                                    {0, 1, 1, 2}, {0, 0, 1, 0}
-                                  }};
-
-const char pieces_l[2][2][4] = {{   // I-piece (line): 2 rotation states
-                                    {0, 1, 2, 3}, {0, 0, 0, 0}
-                                  },
-                                  {
-                                    {0, 0, 0, 0}, {0, 1, 2, 3}
-                                  }};
+boolean autoplaying();
+uint8_t stickControls();
+void sampleControls();
+void waitSampling(unsigned long ms);
+void shiftPiece(short dir, short moves);
+void handleControls();
+void autoplayControls();
+boolean takeGarbage(short cleared);
+void versusPoll();
+void drawOpponent();
+
+// Piece shapes and wall kicks live in pieces.h
 
 // Game constants
 const short MARGIN_TOP = 20;   // Game grid starting Y position
 const short MARGIN_LEFT = 30;  // Game grid starting X position
 const short SIZE = 5;          // Block size in pixels
-const short TYPES = 6;         // Number of piece types
-
-// Color definitions
-const uint16_t PIECE_COLORS[6] = {
-  ST7735_CYAN,    // Type 0: L-piece
-  ST7735_GREEN,   // Type 1: S-piece left
-  ST7735_RED,     // Type 2: S-piece right
-  ST7735_YELLOW,  // Type 3: Square
-  ST7735_MAGENTA, // Type 4: T-piece
-  ST7735_BLUE     // Type 5: I-piece
+const short TYPES = PIECE_TYPES; // Number of piece types
+
+// Color definitions (standard guideline colors, by piece type)
+const uint16_t PIECE_COLORS[PIECE_TYPES] = {
+  ST7735_CYAN,    // I-piece
+  ST7735_BLUE,    // J-piece
+  ST7735_ORANGE,  // L-piece
+  ST7735_YELLOW,  // O-piece (square)
+  ST7735_GREEN,   // S-piece
+  ST7735_MAGENTA, // T-piece
+  ST7735_RED      // Z-piece
 };
+const uint16_t GARBAGE_COLOR = 0x7BEF;  // Gray, for rows sent by the other console
 
 // Game state variables
 word currentType, nextType, rotation;
+word pieceCount;                      // Pieces spawned so far
 short pieceX, pieceY;                 // Current falling piece position
 short oldPieceX, oldPieceY;           // Previous frame piece position
-short piece[2][4];                    // Current piece coordinates
-short oldPiece[2][4];                 // Previous frame piece coordinates
+uint16_t piece;                       // Current piece shape (4x4 mask)
+uint16_t oldPiece;                    // Previous frame piece shape
+short ghostX, ghostY;                 // Where the drawn ghost piece is
+uint16_t ghostPiece;                  // Drawn ghost piece shape (0 = none)
 int interval = 400, score;            // Fall speed, player score
 int oldScore = 0;                     // Score from last display update
-long timer, delayer;                  // Game loop timer, input delay timer
-boolean grid[10][18];                 // Game board: occupied cells (10 wide, 18 tall)
-uint16_t gridColors[10][18];          // Color of each placed block
-boolean b1, b2, b3;                   // Input state flags
+long timer;                           // Gravity timer
+Well well;                            // Game board: placed blocks and their colors
 boolean gameOver = false;             // Game over state
 boolean returnToMenu = false;         // Flag to return to main menu
 
-// Joystick debounce and sensitivity
-unsigned long lastMoveTime = 0; // Last time a piece was moved
-const int MOVE_DELAY = 150;     // Minimum time between moves (ms)
+// Joystick sensitivity and input state (timing is in controls.h)
 const int JOY_THRESHOLD = 200;  // Joystick deadzone (away from center 512)
+ControlQueue controls;          // Control changes not acted on yet
+uint8_t heldControls;           // Controls as last acted on
+AutoShift shift;                // Sideways auto-repeat
+
+// Attract mode: the computer player takes over when nobody touches the
+// controls for a while (also handy for unattended soak runs); touching
+// them hands control straight back
+const unsigned long ATTRACT_DELAY = 20000;  // Idle time before it takes over (ms)
+unsigned long lastInputTime = 0;            // Last time the player touched anything
+AiSearch autoplayer;                        // Computer player's placement search
+word plannedPiece;                          // pieceCount the search is for
+uint8_t autoplayState;                      // Controls the computer player holds
+
+// Versus mode: two consoles linked over Serial (see versus.h)
+const short PEER_LEFT = 96;    // Other console's well, top left corner
+const short PEER_TOP = 40;
+const short PEER_SIZE = 2;     // Its block size in pixels
+boolean versusMode = false;    // Playing against another console
+boolean waitingForPeer;        // Not heard from the other console yet
+Versus versus;                 // Link and what the other console said
+uint16_t drawnPeerRows[WELL_HEIGHT];  // Its well as drawn
+short drawnLinked;             // Border drawn for linked (1), lost (0), none (-1)
+
+// Clear the full lines among the rows the piece that just locked covers
+// (nothing else can have filled up), all in one go. Returns how many.
+short clearLines() {
+  Well before = well;
+  short cleared = well.clearFullRows(pieceY, pieceY + SHAPE_ROWS - 1);
+  if (cleared == 0) return 0;
 
-void checkLines() {
-  boolean full;
-  for (short y = 17; y >= 0; y--) {
-    full = true;
-    for (short x = 0; x < 10; x++) {
-      full = full && grid[x][y];  // Check if entire row is filled
-    }
-    if (full) {
-      breakLine(y);
-      y++;  // Recheck this line as blocks fall
-    }
-  }
-}
-
-void breakLine(short line) {
   tft.invertDisplay(true);  // Flash effect
-  delay(50);
+  waitSampling(50);
   tft.invertDisplay(false);
-  
-  // Shift all lines above down by one
-  for (short y = line; y >= 0; y--) {
-    for (short x = 0; x < 10; x++) {
-      grid[x][y] = grid[x][y - 1];
-      gridColors[x][y] = gridColors[x][y - 1];
-    }
-  }
-  
-  // Clear top line
-  for (short x = 0; x < 10; x++) {
-    grid[x][0] = 0;
-  }
-  
-  score += 10;
-  drawGrid();
+
+  score += 10 * cleared;
+  drawChangedRows(before);
+  return cleared;
 }
 
-void drawGrid() {
-  tft.fillRect(MARGIN_LEFT, MARGIN_TOP, 61, 109, ST7735_BLACK);
-  
-  for (short x = 0; x < 10; x++) {
-    for (short y = 0; y < 18; y++) {
-      if (grid[x][y]) {
-        tft.fillRect(MARGIN_LEFT + (SIZE + 1) * x, 
-                     MARGIN_TOP + (SIZE + 1) * y, 
-                     SIZE, SIZE, gridColors[x][y]);
-      }
-    }
-  }
+// Color cell (x, y) of w is drawn in
+uint16_t cellColor(const Well &w, short x, short y) {
+  if (!w.filled(x, y)) return ST7735_BLACK;
+  uint8_t color = w.colorAt(x, y);
+  return color ? PIECE_COLORS[color - 1] : GARBAGE_COLOR;
 }
 
-void erasePiece(short oldPiece[2][4], short oldX, short oldY) {
-  for (short i = 0; i < 4; i++) {
-    short x = oldX + oldPiece[0][i];
-    short y = oldY + oldPiece[1][i];
-    
-    if (!grid[x][y]) {
-      tft.fillRect(MARGIN_LEFT + (SIZE + 1) * x, 
-                   MARGIN_TOP + (SIZE + 1) * y, 
-                   SIZE, SIZE, ST7735_BLACK);
-    } else {
+// Repaint the cells that differ from the well as it was drawn before.
+// Rows that came through a clear unchanged (all of them below it, and
+// empty ones above the stack) are skipped whole.
+void drawChangedRows(const Well &before) {
+  for (short y = 0; y < WELL_HEIGHT; y++) {
+    if (well.rows[y] == before.rows[y] && well.colors[y] == before.colors[y])
+      continue;
+
+    for (short x = 0; x < WELL_WIDTH; x++) {
+      uint16_t color = cellColor(well, x, y);
+      if (color == cellColor(before, x, y)) continue;
       tft.fillRect(MARGIN_LEFT + (SIZE + 1) * x, 
                    MARGIN_TOP + (SIZE + 1) * y, 
-                   SIZE, SIZE, gridColors[x][y]);
+                   SIZE, SIZE, color);
     }
   }
 }
 
+// Repaint cell (x, y) as the well has it
+void paintCell(short x, short y) {
+  tft.fillRect(MARGIN_LEFT + (SIZE + 1) * x, 
+               MARGIN_TOP + (SIZE + 1) * y, 
+               SIZE, SIZE, cellColor(well, x, y));
+}
+
+void erasePiece(uint16_t oldPiece, short oldX, short oldY) {
+  for (short i = 0; i < 16; i++) {
+    if (!(oldPiece & (1 << i))) continue;
+    short y = oldY + (i >> 2);
+    if (y < 0) continue;  // kicked up past the top
+    paintCell(oldX + (i & 3), y);
+  }
+}
+
 void drawPiece(short type, short x, short y) {
-  for (short i = 0; i < 4; i++) {
-    tft.fillRect(MARGIN_LEFT + (SIZE + 1) * (x + piece[0][i]), 
-                 MARGIN_TOP + (SIZE + 1) * (y + piece[1][i]), 
+  for (short i = 0; i < 16; i++) {
+    if (!(piece & (1 << i)) || y + (i >> 2) < 0) continue;
+    tft.fillRect(MARGIN_LEFT + (SIZE + 1) * (x + (i & 3)), 
+                 MARGIN_TOP + (SIZE + 1) * (y + (i >> 2)), 
                  SIZE, SIZE, PIECE_COLORS[type]);
   }
 }
 
-boolean nextHorizontalCollision(short testPiece[2][4], int amount) {
-  for (short i = 0; i < 4; i++) {
-    short newX = pieceX + testPiece[0][i] + amount;
-    short newY = pieceY + testPiece[1][i];
-    // Check boundaries and existing blocks
-    if (newX > 9 || newX < 0 || grid[newX][newY])
-      return true;
+// Check if cell (x, y) is part of shape placed at (shapeX, shapeY)
+boolean covers(uint16_t shape, short shapeX, short shapeY, short x, short y) {
+  short i = x - shapeX;
+  short j = y - shapeY;
+  if (i < 0 || i > 3 || j < 0 || j > 3) return false;
+  return shape & (1 << (4 * j + i));
+}
+
+// Move the ghost piece (the outline of where the piece will land) to
+// follow the piece. Like updatePiece it erases the cells the old outline
+// leaves and draws the new ones, after erasePiece and before drawPiece:
+// cells the piece covers are left to drawPiece, and ones it has just
+// moved off are drawn again. When only the piece fell, nothing changes.
+void updateGhost() {
+  short landY = well.dropRow(piece, pieceX, pieceY);
+  
+  for (short i = 0; i < 16; i++) {
+    if (!(ghostPiece & (1 << i))) continue;
+    short x = ghostX + (i & 3);
+    short y = ghostY + (i >> 2);
+    if (y < 0 || covers(piece, pieceX, landY, x, y) || 
+        covers(piece, pieceX, pieceY, x, y)) continue;
+    paintCell(x, y);
   }
-  return false;
+  
+  for (short i = 0; i < 16; i++) {
+    if (!(piece & (1 << i))) continue;
+    short x = pieceX + (i & 3);
+    short y = landY + (i >> 2);
+    if (y < 0 || covers(piece, pieceX, pieceY, x, y)) continue;
+    if (covers(ghostPiece, ghostX, ghostY, x, y) && 
+        !covers(oldPiece, oldPieceX, oldPieceY, x, y)) continue;
+    tft.drawRect(MARGIN_LEFT + (SIZE + 1) * x, 
+                 MARGIN_TOP + (SIZE + 1) * y, 
+                 SIZE, SIZE, PIECE_COLORS[currentType]);
+  }
+  
+  ghostX = pieceX;
+  ghostY = landY;
+  ghostPiece = piece;
+}
+
+boolean nextHorizontalCollision(uint16_t testPiece, int amount) {
+  // Check side walls and existing blocks
+  return well.collides(testPiece, pieceX + amount, pieceY);
 }
 
 boolean nextCollision() {
-  for (short i = 0; i < 4; i++) {
-    short y = pieceY + piece[1][i] + 1;
-    short x = pieceX + piece[0][i];
-    // Check bottom boundary or occupied cell
-    if (y > 17 || grid[x][y])
-      return true;
-  }
-  return false;
+  // Check bottom boundary or occupied cell one row down
+  return well.collides(piece, pieceX, pieceY + 1);
 }
 
 boolean checkGameOver() {
   // Check if blocks reached top rows
-  for (short x = 0; x < 10; x++) {
-    if (grid[x][0] || grid[x][1]) {
-      return true;
-    }
-  }
-  return false;
+  return well.rows[0] || well.rows[1];
 }
 
-void showGameOver() {
+// Game over screen; won is for versus mode, when the other console
+// topped out first
+void showGameOver(boolean won) {
   for (int i = 0; i < 3; i++) {
     tft.invertDisplay(true);
-    delay(100);
+    waitSampling(100);
     tft.invertDisplay(false);
-    delay(100);
+    waitSampling(100);
   }
   
+  uint16_t color = won ? ST7735_GREEN : ST7735_RED;
   tft.fillRect(15, 40, 98, 70, ST7735_BLACK);
-  tft.drawRect(15, 40, 98, 70, ST7735_RED);
-  tft.drawRect(16, 41, 96, 68, ST7735_RED);
+  tft.drawRect(15, 40, 98, 70, color);
+  tft.drawRect(16, 41, 96, 68, color);
   
-  tft.setTextColor(ST7735_RED);
+  tft.setTextColor(color);
   tft.setTextSize(2);
   tft.setCursor(25, 48);
-  tft.print("GAME");
+  tft.print(won ? "YOU" : "GAME");
   tft.setCursor(25, 64);
-  tft.print("OVER");
+  tft.print(won ? "WIN" : "OVER");
   
   tft.setTextColor(ST7735_WHITE);
   tft.setTextSize(1);
@@ -249,12 +259,7 @@ void showGameOver() {
 }
 
 void resetGame() {
-  for (short x = 0; x < 10; x++) {
-    for (short y = 0; y < 18; y++) {
-      grid[x][y] = 0;
-      gridColors[x][y] = ST7735_BLACK;
-    }
-  }
+  well.clear();
   
   score = 0;
   oldScore = 0;
@@ -267,28 +272,31 @@ void resetGame() {
   nextType = random(TYPES);
   generate();
   
+  if (versusMode) {
+    versus.newRound();
+    versus.sendWell(well);
+  }
+  
+  controls.reset(0, millis());
+  heldControls = 0;
+  shift.hold(0, millis());
   timer = millis();
 }
 
 void generate() {
+  pieceCount++;
   currentType = nextType;
   nextType = random(TYPES);
   
-  if (currentType != 5)
-    pieceX = random(9);
-  else
-    pieceX = random(7);
-    
+  pieceX = SPAWN_X;
   pieceY = 0;
   rotation = 0;
-  copyPiece(piece, currentType, rotation);
+  piece = pieceMask(currentType, rotation);
   
   oldPieceX = pieceX;
   oldPieceY = pieceY;
-  for (short i = 0; i < 4; i++) {
-    oldPiece[0][i] = piece[0][i];
-    oldPiece[1][i] = piece[1][i];
-  }
+  oldPiece = piece;
+  ghostPiece = 0;  // the last one is under the piece that just locked
   
   drawNextPiece();
 }
@@ -296,73 +304,34 @@ void generate() {
 void drawNextPiece() {
   tft.fillRect(110, 9, 50, 20, ST7735_BLACK);
   
-  short nPiece[2][4];
-  copyPiece(nPiece, nextType, 0);
+  uint16_t nPiece = pieceMask(nextType, 0);
   
-  for (short i = 0; i < 4; i++) {
-    tft.fillRect(110 + 4 * nPiece[0][i], 
-                 9 + 4 * nPiece[1][i], 
+  for (short i = 0; i < 16; i++) {
+    if (!(nPiece & (1 << i))) continue;
+    tft.fillRect(110 + 4 * (i & 3), 
+                 9 + 4 * (i >> 2), 
                  3, 3, PIECE_COLORS[nextType]);
   }
 }
 
-void copyPiece(short piece[2][4], short type, short rotation) {
-  switch (type) {
-    case 0:
-      for (short i = 0; i < 4; i++) {
-        piece[0][i] = pieces_L_l[rotation][0][i];
-        piece[1][i] = pieces_L_l[rotation][1][i];
-      }
-      break;
-    case 1:
-      for (short i = 0; i < 4; i++) {
-        piece[0][i] = pieces_S_l[rotation][0][i];
-        piece[1][i] = pieces_S_l[rotation][1][i];
-      }
-      break;
-    case 2:
-      for (short i = 0; i < 4; i++) {
-        piece[0][i] = pieces_S_r[rotation][0][i];
-        piece[1][i] = pieces_S_r[rotation][1][i];
-      }
-      break;
-    case 3:
-      for (short i = 0; i < 4; i++) {
-        piece[0][i] = pieces_Sq[0][0][i];
-        piece[1][i] = pieces_Sq[0][1][i];
-      }
-      break;
-    case 4:
-      for (short i = 0; i < 4; i++) {
-        piece[0][i] = pieces_T[rotation][0][i];
-        piece[1][i] = pieces_T[rotation][1][i];
-      }
-      break;
-    case 5:
-      for (short i = 0; i < 4; i++) {
-        piece[0][i] = pieces_l[rotation][0][i];
-        piece[1][i] = pieces_l[rotation][1][i];
-      }
-      break;
+// Turn the piece clockwise, trying the SRS wall kicks in order.
+// Returns false (and leaves the piece alone) if none of them fit.
+boolean tryRotate() {
+  short next = (rotation + 1) % ROTATIONS;
+  uint16_t turned = pieceMask(currentType, next);
+  
+  for (short test = 0; test < KICK_TESTS; test++) {
+    int8_t dx, dy;
+    kickOffset(currentType, rotation, test, dx, dy);
+    if (!well.collides(turned, pieceX + dx, pieceY + dy)) {
+      piece = turned;
+      rotation = next;
+      pieceX += dx;
+      pieceY += dy;
+      return true;
+    }
   }
-}
-
-short getMaxRotation(short type) {
-  // Return maximum rotation states for each piece type
-  if (type == 1 || type == 2 || type == 5)      // S, S_r, I-pieces: 2 states
-    return 2;
-  else if (type == 0 || type == 4)              // L, T-pieces: 4 states
-    return 4;
-  else if (type == 3)                           // Square: 1 state (no rotation)
-    return 1;
-  else
-    return 0;
-}
-
-boolean canRotate(short rotation) {
-  short testPiece[2][4];
-  copyPiece(testPiece, currentType, rotation);
-  return !nextHorizontalCollision(testPiece, 0);
+  return false;
 }
 
 void updateScore() {
@@ -389,22 +358,216 @@ void drawLayout() {
   tft.setCursor(75, 4);
   tft.print("NEXT:");
   
+  if (versusMode) {
+    tft.setCursor(PEER_LEFT + 8, PEER_TOP - 10);
+    tft.print("VS");
+    memset(drawnPeerRows, 0, sizeof drawnPeerRows);
+    drawnLinked = -1;
+    drawOpponent();
+  }
+  
   updateScore();
 }
 
 void updatePiece() {
   erasePiece(oldPiece, oldPieceX, oldPieceY);
+  updateGhost();
   drawPiece(currentType, pieceX, pieceY);
   
   oldPieceX = pieceX;
   oldPieceY = pieceY;
-  for (short i = 0; i < 4; i++) {
-    oldPiece[0][i] = piece[0][i];
-    oldPiece[1][i] = piece[1][i];
+  oldPiece = piece;
+}
+
+// Place the piece in the grid and bring in the next one
+void lockPiece() {
+  // Color indices start at 1, 0 is empty
+  well.place(piece, pieceX, pieceY, currentType + 1);
+  short cleared = clearLines();
+  boolean buried = versusMode && takeGarbage(cleared);
+  updateScore();
+  
+  if (buried || checkGameOver()) {
+    if (versusMode) versus.topOut();
+    showGameOver(false);
+    return;
+  }
+  
+  generate();  // Spawn next piece
+  updatePiece();
+}
+
+// Drop the piece straight down to where the ghost shows and lock it there
+void hardDrop() {
+  pieceY = well.dropRow(piece, pieceX, pieceY);
+  updatePiece();
+  lockPiece();
+  timer = millis();
+}
+
+boolean autoplaying() {
+  return millis() - lastInputTime > ATTRACT_DELAY;
+}
+
+// Controls the joystick and button are held at
+uint8_t stickControls() {
+  int x = analogRead(joyX);
+  int y = analogRead(joyY);
+  uint8_t state = 0;
+  
+  if (x > 512 + JOY_THRESHOLD) state |= CTL_LEFT;
+  else if (x < 512 - JOY_THRESHOLD) state |= CTL_RIGHT;
+  if (y < 512 - JOY_THRESHOLD) state |= CTL_SOFT;
+  else if (y > 512 + JOY_THRESHOLD) state |= CTL_DROP;
+  if (!digitalRead(button)) state |= CTL_TURN;
+  return state;
+}
+
+// Note the controls as they are now: the joystick's, or in attract mode
+// the computer player's. Called a few times a loop, so every change gets
+// the time it happened.
+void sampleControls() {
+  uint8_t state = stickControls();
+  if (state) {
+    lastInputTime = millis();
+  } else if (autoplaying()) {
+    state = autoplayState;
+  }
+  controls.sample(state, millis());
+}
+
+// delay() that keeps sampling the controls (and in versus mode keeps
+// the link going)
+void waitSampling(unsigned long ms) {
+  unsigned long start = millis();
+  while (millis() - start < ms) {
+    sampleControls();
+    if (versusMode) versusPoll();
+  }
+}
+
+// Move the piece up to moves columns in direction dir, stopping at a wall
+void shiftPiece(short dir, short moves) {
+  for (; moves > 0; moves--) {
+    if (nextHorizontalCollision(piece, dir)) return;
+    pieceX += dir;
+  }
+}
+
+// Act on the control changes since last time, in the order they
+// happened and timed from when they happened: turns and hard drops on
+// press, a sideways move on press and then auto-repeat (DAS/ARR), which
+// can be several moves if the loop was slow. Gravity runs on its own
+// timer. The piece is redrawn once for everything.
+void handleControls() {
+  ControlEdge edge;
+  while (controls.next(edge)) {
+    uint8_t pressed = edge.state & ~heldControls;
+    heldControls = edge.state;
+    
+    if (pressed & CTL_TURN) tryRotate();
+    
+    short dir = 0;
+    if (edge.state & CTL_LEFT) dir = -1;
+    else if (edge.state & CTL_RIGHT) dir = 1;
+    if (shift.hold(dir, edge.time)) shiftPiece(dir, 1);
+    
+    if (pressed & CTL_DROP) {
+      hardDrop();
+      if (gameOver) return;
+    }
+  }
+  shiftPiece(shift.dir, shift.due(millis()));
+  
+  // Soft drop: accelerate while the stick is held down
+  interval = heldControls & CTL_SOFT ? 50 : 400;
+  
+  if (piece != oldPiece || pieceX != oldPieceX || pieceY != oldPieceY) {
+    updatePiece();
+  }
+}
+
+// Work the controls towards where the computer player wants the piece:
+// think about it a few placements per loop, then turn it, slide it over
+// and hard drop it. Each is a tap (pressed one loop, let go the next),
+// so every press does exactly one thing.
+void autoplayControls() {
+  if (plannedPiece != pieceCount) {
+    autoplayer.begin(well, currentType, nextType, aiWeights);
+    plannedPiece = pieceCount;
+  }
+  
+  uint8_t want = 0;
+  if (autoplayer.step(AI_PLACEMENTS_PER_STEP) && autoplayer.bestRotation >= 0) {
+    if (rotation != autoplayer.bestRotation) {
+      want = CTL_TURN;
+    } else if (pieceX > autoplayer.bestX && !nextHorizontalCollision(piece, -1)) {
+      want = CTL_LEFT;
+    } else if (pieceX < autoplayer.bestX && !nextHorizontalCollision(piece, 1)) {
+      want = CTL_RIGHT;
+    } else {
+      want = CTL_DROP;  // There (or as close as it gets)
+    }
+  }
+  autoplayState = controls.state & want ? 0 : want;
+}
+
+// Versus mode: send garbage for the lines just cleared, or with none
+// cleared push up the garbage that came in. Returns true if that
+// buried the stack past the top.
+boolean takeGarbage(short cleared) {
+  boolean buried = false;
+  uint8_t rows = versus.lock(cleared);
+  if (rows) {
+    Well before = well;
+    buried = well.raise(rows, random(WELL_WIDTH));
+    drawChangedRows(before);
+  }
+  versus.sendWell(well);
+  return buried;
+}
+
+// Move bytes between Serial and the link as far as each has room, so
+// the game never waits on the other console
+void versusPoll() {
+  unsigned long now = millis();
+  while (Serial.available() > 0) {
+    versus.receive(Serial.read(), now);
+  }
+  versus.poll(now);
+  while (versus.link.txPending() && Serial.availableForWrite() > 0) {
+    Serial.write(versus.link.txByte());
+  }
+}
+
+// Redraw the cells of the other console's well that changed since last
+// time, in a box that turns red while the link is down
+void drawOpponent() {
+  short linked = versus.linked(millis());
+  if (linked != drawnLinked) {
+    tft.drawRect(PEER_LEFT - 1, PEER_TOP - 1, 
+                 (PEER_SIZE + 1) * WELL_WIDTH + 1, (PEER_SIZE + 1) * WELL_HEIGHT + 1, 
+                 linked ? ST7735_WHITE : ST7735_RED);
+    drawnLinked = linked;
+  }
+  
+  for (short y = 0; y < WELL_HEIGHT; y++) {
+    uint16_t changed = versus.peerRows[y] ^ drawnPeerRows[y];
+    if (!changed) continue;
+    
+    for (short x = 0; x < WELL_WIDTH; x++) {
+      if (!(changed & (1 << x))) continue;
+      tft.fillRect(PEER_LEFT + (PEER_SIZE + 1) * x, 
+                   PEER_TOP + (PEER_SIZE + 1) * y, 
+                   PEER_SIZE, PEER_SIZE, 
+                   versus.peerRows[y] & (1 << x) ? ST7735_WHITE : ST7735_BLACK);
+    }
+    drawnPeerRows[y] = versus.peerRows[y];
   }
 }
 
 void tetrisSetup() {
+  versusMode = false;
   tft.fillScreen(ST7735_BLACK);
   
   tft.setTextColor(ST7735_CYAN);
@@ -413,12 +576,65 @@ void tetrisSetup() {
   tft.print("TETRIS");
   delay(1500);
   
+  lastInputTime = millis();
   resetGame();
 }
 
+// Versus mode: wait (without blocking) for the other console, which
+// has to be in versus mode too, then play as usual
+void tetrisVersusSetup() {
+  versusMode = true;
+  waitingForPeer = true;
+  gameOver = false;
+  returnToMenu = false;
+  versus.begin(millis());
+  
+  tft.fillScreen(ST7735_BLACK);
+  tft.setTextColor(ST7735_CYAN);
+  tft.setTextSize(2);
+  tft.setCursor(20, 40);
+  tft.print("TETRIS");
+  tft.setCursor(50, 58);
+  tft.print("VS");
+  
+  tft.setTextColor(ST7735_WHITE);
+  tft.setTextSize(1);
+  tft.setCursor(20, 85);
+  tft.print("Waiting for the");
+  tft.setCursor(25, 95);
+  tft.print("other console");
+  
+  lastInputTime = millis();
+}
+
 void tetrisLoop() {
+  if (versusMode) {
+    versusPoll();
+    if (waitingForPeer) {
+      if (!digitalRead(joyButton)) {
+        returnToMenu = true;
+      } else if (versus.peerSeen) {
+        waitingForPeer = false;
+        resetGame();
+      }
+      return;
+    }
+    if (!gameOver) {
+      drawOpponent();
+      if (versus.won()) {
+        showGameOver(true);
+        return;
+      }
+    }
+  }
+  
   // Handle game over screen
   if (gameOver) {
+    if (autoplaying()) {  // Attract mode just starts over
+      waitSampling(2000);
+      resetGame();
+      return;
+    }
     if (!digitalRead(joyButton) || analogRead(joyY) < 512 - JOY_THRESHOLD || 
         analogRead(joyY) > 512 + JOY_THRESHOLD || analogRead(joyX) < 512 - JOY_THRESHOLD || 
         analogRead(joyX) > 512 + JOY_THRESHOLD || !digitalRead(button)) {
@@ -433,24 +649,11 @@ void tetrisLoop() {
     return;
   }
   
+  sampleControls();
   if (millis() - timer > interval) {
-    checkLines();
-    updateScore();
-    
     if (nextCollision()) {
-      // Place piece in grid
-      for (short i = 0; i < 4; i++) {
-        grid[pieceX + piece[0][i]][pieceY + piece[1][i]] = 1;
-        gridColors[pieceX + piece[0][i]][pieceY + piece[1][i]] = PIECE_COLORS[currentType];
-      }
-      
-      if (checkGameOver()) {
-        showGameOver();
-        return;
-      }
-      
-      generate();  // Spawn next piece
-      drawPiece(currentType, pieceX, pieceY);
+      lockPiece();
+      if (gameOver) return;
     } else {
       pieceY++;  // Move piece down
       updatePiece();
@@ -458,55 +661,11 @@ void tetrisLoop() {
     timer = millis();
   }
   
-  int x = analogRead(joyX);
-  int y = analogRead(joyY);
-  
-  // Handle horizontal movement
-  if (millis() - lastMoveTime > MOVE_DELAY) {
-    if (x > 512 + JOY_THRESHOLD) {  // Move left
-      if (!nextHorizontalCollision(piece, -1)) {
-        pieceX--;
-        updatePiece();
-        lastMoveTime = millis();
-      }
-    } else if (x < 512 - JOY_THRESHOLD) {  // Move right
-      if (!nextHorizontalCollision(piece, 1)) {
-        pieceX++;
-        updatePiece();
-        lastMoveTime = millis();
-      }
-    }
-    
-    // Soft drop: accelerate on down joystick
-    if (y < 512 - JOY_THRESHOLD) {
-      interval = 50;
-    } else {
-      interval = 400;
-    }
-  }
-  
-  if (y > 512 + JOY_THRESHOLD || !digitalRead(button)) {
-    if (b3) {
-      short newRotation = rotation;
-      
-      if (rotation == getMaxRotation(currentType) - 1 && canRotate(0)) {
-        newRotation = 0;
-      } else if (canRotate(rotation + 1)) {
-        newRotation = rotation + 1;
-      }
-      
-      if (newRotation != rotation) {
-        rotation = newRotation;
-        copyPiece(piece, currentType, rotation);
-        updatePiece();
-      }
-      
-      b3 = false;
-      delayer = millis();
-    }
-  } else if (millis() - delayer > 200) {
-    b3 = true;
+  if (autoplaying()) {
+    autoplayControls();
   }
+  sampleControls();
+  handleControls();
 }
 
 bool tetrisCheckReturnToMenu() {
@@ -6,6 +6,7 @@
 
 // Function declarations
 void tetrisSetup();
+void tetrisVersusSetup();
 void tetrisLoop();
 bool tetrisCheckReturnToMenu();
 
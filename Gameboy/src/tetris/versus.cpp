@@ -0,0 +1,120 @@
+/*Tetris versus mode: what two linked consoles tell each other*/
+#include "versus.h"
+
+void Versus::begin(unsigned long now)
+{
+    link.reset();
+    round = 0;
+    toppedOut = false;
+    garbageSent = 0;
+    peerSeen = false;
+    peerToppedOut = peerWasOver = false;
+    peerGarbage = garbageTaken = 0;
+    memset(peerRows, 0, sizeof peerRows);
+    lastHeard = now;
+    statusDue = true;
+    statusAt = now;
+    wellDue = false;
+}
+
+void Versus::newRound()
+{
+    round++;
+    toppedOut = false;
+    garbageSent = 0;
+    garbageTaken = peerGarbage;  // whatever was aimed at the last game
+    peerWasOver = peerToppedOut;
+    statusDue = true;
+}
+
+uint8_t Versus::lock(uint8_t cleared)
+{
+    uint16_t sent = garbageFor(cleared);
+    uint16_t cancel = incoming() < sent ? incoming() : sent;
+    garbageTaken += cancel;
+    sent -= cancel;
+    if (sent) {
+        garbageSent += sent;
+        statusDue = true;
+    }
+    if (cleared) return 0;
+
+    uint16_t rows = incoming() < VERSUS_MAX_RAISE ? incoming() : VERSUS_MAX_RAISE;
+    garbageTaken += rows;
+    return rows;
+}
+
+void Versus::topOut()
+{
+    toppedOut = true;
+    statusDue = true;
+}
+
+void Versus::sendWell(const Well &well)
+{
+    wellOut[0] = round;
+    uint8_t *bits = wellOut + 1;
+    memset(bits, 0, VERSUS_WELL_BYTES);
+    uint8_t bit = 0;
+    for (int8_t y = 0; y < WELL_HEIGHT; y++) {
+        for (int8_t x = 0; x < WELL_WIDTH; x++, bit++) {
+            if (well.rows[y] & (1 << x)) bits[bit >> 3] |= 1 << (bit & 7);
+        }
+    }
+    wellDue = true;
+}
+
+void Versus::poll(unsigned long now)
+{
+    if (now - statusAt >= VERSUS_STATUS_MS) statusDue = true;
+    if (statusDue) {
+        uint8_t status[4] = {round, (uint8_t)(toppedOut ? VERSUS_TOPPED_OUT : 0),
+                             (uint8_t)garbageSent, (uint8_t)(garbageSent >> 8)};
+        if (link.send(VERSUS_STATUS, status, sizeof status)) {
+            statusDue = false;
+            statusAt = now;
+        }
+    }
+    if (wellDue && link.send(VERSUS_WELL, wellOut, sizeof wellOut)) {
+        wellDue = false;
+    }
+}
+
+void Versus::peerRoundIs(uint8_t round)
+{
+    if (peerSeen && round == peerRound) return;
+    peerSeen = true;
+    peerRound = round;
+    peerToppedOut = peerWasOver = false;
+    peerGarbage = garbageTaken = 0;
+    memset(peerRows, 0, sizeof peerRows);
+}
+
+void Versus::handle(const LinkFrame &frame)
+{
+    if (frame.type == VERSUS_STATUS && frame.length == 4) {
+        peerRoundIs(frame.payload[0]);
+        peerToppedOut = frame.payload[1] & VERSUS_TOPPED_OUT;
+        uint16_t sent = frame.payload[2] | (uint16_t)frame.payload[3] << 8;
+        if (sent > peerGarbage) peerGarbage = sent;
+    }
+    else if (frame.type == VERSUS_WELL && frame.length == 1 + VERSUS_WELL_BYTES) {
+        peerRoundIs(frame.payload[0]);
+        const uint8_t *bits = frame.payload + 1;
+        uint8_t bit = 0;
+        for (int8_t y = 0; y < WELL_HEIGHT; y++) {
+            uint16_t row = 0;
+            for (int8_t x = 0; x < WELL_WIDTH; x++, bit++) {
+                if (bits[bit >> 3] & (1 << (bit & 7))) row |= 1 << x;
+            }
+            peerRows[y] = row;
+        }
+    }
+}
+
+void Versus::receive(uint8_t byte, unsigned long now)
+{
+    if (!link.receive(byte)) return;
+    lastHeard = now;
+    handle(link.frame);
+}
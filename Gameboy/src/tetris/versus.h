@@ -0,0 +1,107 @@
+/*Tetris versus mode: what two linked consoles tell each other*/
+#ifndef VERSUS_H
+#define VERSUS_H
+#include "../platform.h"
+#include "link.h"
+#include "well.h"
+
+// frame types
+#define VERSUS_STATUS 1   // round, flags, garbage sent (16 bits, LSB first)
+#define VERSUS_WELL 2     // round, then the well's cells one bit each
+
+// status is sent whenever it changes and at least this often; the
+// totals in it make up for any frame that gets lost
+#define VERSUS_STATUS_MS 500
+// nothing heard for this long means the other console is gone
+#define VERSUS_TIMEOUT_MS 3000
+// most garbage rows pushed into the well in one go
+#define VERSUS_MAX_RAISE 4
+
+#define VERSUS_TOPPED_OUT 0x01   // status flag
+
+#define VERSUS_WELL_BYTES ((WELL_WIDTH * WELL_HEIGHT + 7) / 8)
+
+// garbage rows sent for clearing 0-4 lines at once
+static inline uint8_t garbageFor(uint8_t lines)
+{
+    return lines < 2 ? 0 : lines == 4 ? 4 : lines - 1;
+}
+
+// Both consoles' side of a versus game. Garbage goes over as a running
+// total per round, and status repeats, so a lost frame only delays
+// things. Rounds count games, so news about an earlier game is told
+// apart; each console starts a new one whenever it restarts.
+//
+// Like Link it does no I/O itself: receive() takes bytes that came in,
+// and the bytes to send wait in link.
+struct Versus {
+    Link link;
+
+    // this console
+    uint8_t round;
+    bool toppedOut;
+    uint16_t garbageSent;
+
+    // the other one
+    bool peerSeen;
+    uint8_t peerRound;
+    bool peerToppedOut;
+    bool peerWasOver;         // it had already topped out when this round began
+    uint16_t peerGarbage;     // sent this round
+    uint16_t garbageTaken;    // of that, pushed into the well or cancelled
+    uint16_t peerRows[WELL_HEIGHT];
+    unsigned long lastHeard;
+
+    void begin(unsigned long now);
+
+    // a game starts here
+    void newRound();
+
+    // garbage rows waiting to come in
+    uint16_t incoming() const
+    {
+        return peerGarbage - garbageTaken;
+    }
+
+    // A piece locked and cleared lines (maybe 0). The garbage those
+    // lines are worth cancels incoming garbage first, and the rest is
+    // sent. With nothing cleared, returns how many rows of incoming
+    // garbage to push into the well now.
+    uint8_t lock(uint8_t cleared);
+
+    // this console's game is over
+    void topOut();
+
+    // the other console topped out while this one was still playing
+    bool won() const
+    {
+        return peerToppedOut && !peerWasOver && !toppedOut;
+    }
+
+    // send a copy of well for the other console's preview (the newest
+    // one goes as soon as there's room)
+    void sendWell(const Well &well);
+
+    // true while the other console is still heard from
+    bool linked(unsigned long now) const
+    {
+        return peerSeen && now - lastHeard < VERSUS_TIMEOUT_MS;
+    }
+
+    // queue status and well frames that are due
+    void poll(unsigned long now);
+
+    // take one received byte
+    void receive(uint8_t byte, unsigned long now);
+
+private:
+    bool statusDue;
+    unsigned long statusAt;   // when status was last sent
+    bool wellDue;
+    uint8_t wellOut[1 + VERSUS_WELL_BYTES];
+
+    void peerRoundIs(uint8_t round);
+    void handle(const LinkFrame &frame);
+};
+
+#endif
@@ -0,0 +1,118 @@
+/*Tetris well: occupied cells as row bitmasks, colors packed per row*/
+#include "well.h"
+
+void Well::clear()
+{
+    memset(rows, 0, sizeof rows);
+    memset(colors, 0, sizeof colors);
+    memset(heights, 0, sizeof heights);
+}
+
+void Well::measure()
+{
+    // the first row (from the top) a column shows up in is its top
+    uint16_t seen = 0;
+    memset(heights, 0, sizeof heights);
+    for (int8_t y = 0; y < WELL_HEIGHT && seen != WELL_FULL; y++) {
+        uint16_t top = rows[y] & ~seen;
+        for (int8_t x = 0; top >> x; x++) {
+            if (top & (1 << x)) heights[x] = WELL_HEIGHT - y;
+        }
+        seen |= top;
+    }
+}
+
+bool Well::collides(uint16_t shape, int8_t x, int8_t y) const
+{
+    for (int8_t j = 0; j < SHAPE_ROWS; j++) {
+        if (!SHAPE_ROW(shape, j)) continue;
+        uint16_t row = shapeRowAt(SHAPE_ROW(shape, j), x);
+        if (row == 0xFFFF || y + j >= WELL_HEIGHT) return true;
+        if (y + j >= 0 && (rows[y + j] & row)) return true;
+    }
+    return false;
+}
+
+void Well::place(uint16_t shape, int8_t x, int8_t y,
+                 uint8_t color)
+{
+    for (int8_t j = 0; j < SHAPE_ROWS; j++) {
+        int8_t wy = y + j;
+        if (!SHAPE_ROW(shape, j) || wy < 0 || wy >= WELL_HEIGHT) continue;
+        uint16_t row = shapeRowAt(SHAPE_ROW(shape, j), x);
+        rows[wy] |= row;
+        for (int8_t cx = 0; cx < WELL_WIDTH; cx++) {
+            if (row & (1 << cx)) {
+                colors[wy] = (colors[wy] & ~(7UL << (3 * cx))) |
+                             ((uint32_t)color << (3 * cx));
+                if (heights[cx] < WELL_HEIGHT - wy) heights[cx] = WELL_HEIGHT - wy;
+            }
+        }
+    }
+}
+
+uint8_t Well::clearFullRows(int8_t top, int8_t bottom)
+{
+    if (top < 0) top = 0;
+    if (bottom >= WELL_HEIGHT) bottom = WELL_HEIGHT - 1;
+
+    // walk up from the bottom, moving each kept row down past the full
+    // ones found so far
+    uint8_t cleared = 0;
+    for (int8_t y = bottom; y >= 0; y--) {
+        if (y >= top && rows[y] == WELL_FULL) {
+            cleared++;
+        }
+        else if (cleared) {
+            rows[y + cleared] = rows[y];
+            colors[y + cleared] = colors[y];
+        }
+    }
+    memset(rows, 0, cleared * sizeof rows[0]);
+    memset(colors, 0, cleared * sizeof colors[0]);
+    if (cleared) measure();
+    return cleared;
+}
+
+bool Well::raise(uint8_t count, int8_t hole)
+{
+    if (count == 0) return false;
+    if (count > WELL_HEIGHT) count = WELL_HEIGHT;
+
+    bool over = false;
+    for (int8_t y = 0; y < WELL_HEIGHT; y++) {
+        if (y < count && rows[y]) over = true;
+        if (y + count < WELL_HEIGHT) {
+            rows[y] = rows[y + count];
+            colors[y] = colors[y + count];
+        }
+        else {
+            rows[y] = WELL_FULL & ~(1 << hole);
+            colors[y] = 0;
+        }
+    }
+    measure();
+    return over;
+}
+
+int8_t Well::dropRow(uint16_t shape, int8_t x, int8_t y) const
+{
+    // each column of the shape can come down until its bottom cell sits
+    // on that column's top; the piece stops at the first one to touch
+    int8_t land = WELL_HEIGHT;
+    for (int8_t i = 0; i < 4; i++) {
+        int8_t bottom = SHAPE_ROWS - 1;
+        while (bottom >= 0 && !(shape & (1 << (4 * bottom + i)))) bottom--;
+        if (bottom < 0) continue;
+
+        int8_t rest = WELL_HEIGHT - heights[x + i] - 1 - bottom;
+        if (rest < land) land = rest;
+    }
+
+    // everything above the column tops is empty, so if that's no higher
+    // than the piece it's where the piece ends up
+    if (land >= y) return land;
+
+    while (!collides(shape, x, y + 1)) y++;
+    return y;
+}
@@ -0,0 +1,98 @@
+/*Tetris well: occupied cells as row bitmasks, colors packed per row*/
+#ifndef WELL_H
+#define WELL_H
+#include "../platform.h"
+
+#define WELL_WIDTH 10
+#define WELL_HEIGHT 18
+
+// a row with every cell filled
+#define WELL_FULL ((1 << WELL_WIDTH) - 1)
+
+// rows in a piece's shape (pieces fit in 4x4)
+#define SHAPE_ROWS 4
+
+// row j of a piece shape
+#define SHAPE_ROW(shape, j) (((shape) >> (4 * (j))) & 0x0F)
+
+// Cell (x, y) is bit x of rows[y], y = 0 at the top. Each cell also has
+// a 3-bit color index at bits 3x..3x+2 of colors[y]: 1-7 for the piece
+// that left it, 0 for an empty cell or a garbage one (see raise()).
+// heights[x] caches how tall column x stands (rows from the floor up to
+// its top filled cell, 0 if empty); place() and clearFullRows() keep it
+// up to date. That's 118 bytes for the whole well.
+//
+// A piece shape is a 4x4 mask of row masks: row j (top row first) in
+// bits 4j..4j+3, bit 4j + i for the piece's column i. Placing it at
+// (x, y) shifts row j left by x onto well row y + j, so collision is a
+// shift and an AND per row, and a full line is just rows[y] == WELL_FULL.
+struct Well {
+    uint16_t rows[WELL_HEIGHT];
+    uint32_t colors[WELL_HEIGHT];
+    uint8_t heights[WELL_WIDTH];
+
+    // empty the well
+    void clear();
+
+    // check if cell (x, y) is filled (false outside the well)
+    bool filled(int8_t x, int8_t y) const
+    {
+        if (x < 0 || x >= WELL_WIDTH || y < 0 || y >= WELL_HEIGHT) return false;
+        return rows[y] & (1 << x);
+    }
+
+    // color index of cell (x, y), 0 if empty or garbage
+    uint8_t colorAt(int8_t x, int8_t y) const
+    {
+        return (colors[y] >> (3 * x)) & 7;
+    }
+
+    bool rowFull(int8_t y) const
+    {
+        return rows[y] == WELL_FULL;
+    }
+
+    // check if shape at (x, y) overlaps a filled cell, a side wall or
+    // the floor. Shape rows above the well only hit the walls.
+    bool collides(uint16_t shape, int8_t x, int8_t y) const;
+
+    // fill the cells of shape at (x, y) with color index color (1-7).
+    // The shape has to fit (see collides()); rows above the well are
+    // dropped.
+    void place(uint16_t shape, int8_t x, int8_t y,
+               uint8_t color);
+
+    // take out the full rows among y = top..bottom (the rows a piece
+    // just landed on; clamped to the well) in one pass, everything
+    // above dropping onto them. Returns how many rows went.
+    uint8_t clearFullRows(int8_t top, int8_t bottom);
+
+    // push the whole stack up count rows and fill the bottom ones with
+    // garbage: every cell but column hole, color index 0. Returns true
+    // if filled cells went out of the top.
+    bool raise(uint8_t count, int8_t hole);
+
+    // row shape at (x, y) comes to rest at if it drops straight down.
+    // Worked out from the column heights; only a piece tucked under an
+    // overhang has to be stepped down row by row.
+    int8_t dropRow(uint16_t shape, int8_t x, int8_t y) const;
+
+    // rebuild heights from rows (after changing rows directly)
+    void measure();
+};
+
+// shape row shifted to column x, or 0xFFFF if any of it would be outside
+// the well's side walls
+static inline uint16_t shapeRowAt(uint16_t mask, int8_t x)
+{
+    if (x < 0) {
+        if (mask & ((1 << -x) - 1)) return 0xFFFF;
+        mask >>= -x;
+    }
+    else {
+        mask <<= x;
+    }
+    return mask & ~WELL_FULL ? 0xFFFF : mask;
+}
+
+#endif
@@ -0,0 +1,120 @@
+// Host-side driver for the console's latency recorder
+// (Gameboy/src/latency/latency.h), so input-latency regressions can be
+// checked on a PC whenever frame pacing or rendering changes.
+//
+// Build:
+//   g++ -O2 -std=c++11 -o latency_replay latency_replay.cpp
+//
+// Usage:
+//   latency_replay < trace.txt
+//       Replay a trace. Each line is "I <us> <bits>" for the inputs as
+//       latencyPoll() samples them (LAT_* bits in latency.h), "F <us>"
+//       for a finished display update, or "M <bits>" for the inputs the
+//       game acts on when let go (latencyBegin()'s releaseInputs); lines
+//       starting with # are comments. host/traces/ holds traces for known
+//       cases, e.g.
+//         latency_replay --max-ms 10 < traces/release_repress.txt
+//   latency_replay --loop <period_ms> <draw_ms> [edges] [seed]
+//       Scripted input against a game loop that samples input, spends
+//       draw_ms drawing, then sleeps period_ms (e.g. Minesweeper: 150 5).
+//       Each input is held for a while and let go before the next one;
+//       one the loop never saw held is not drawn.
+//
+// Exits non-zero if --max-ms is given and the worst sample exceeds it.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../Gameboy/src/latency/latency.h"
+
+static uint32_t xorshift(uint32_t &s) {
+  s ^= s << 13;
+  s ^= s >> 17;
+  s ^= s << 5;
+  return s;
+}
+
+static void replayTrace(LatencyRecorder &r, FILE *in) {
+  char line[80];
+  char kind;
+  unsigned long us, bits;
+  while (fgets(line, sizeof line, in)) {
+    int n = sscanf(line, " %c %lu %lu", &kind, &us, &bits);
+    if (kind == 'I' && n == 3) r.poll((uint8_t)bits, us);
+    else if (kind == 'F' && n == 2) r.displayWrite(us);
+    else if (kind == 'M' && n == 2) r.releaseInputs = (uint8_t)us;
+  }
+}
+
+// The stick is pushed, held for a while and let go at random times, and
+// polled as it changes, as the console's yield() hook does while a game
+// sleeps. The loop draws for a push it finds still held when it samples;
+// one let go before that is never drawn.
+static void replayLoop(LatencyRecorder &r, uint32_t periodMs, uint32_t drawMs,
+                       uint32_t edges, uint32_t seed) {
+  uint32_t rng = seed ? seed : 1;
+  uint32_t loopUs = (periodMs + drawMs) * 1000;
+  uint32_t now = 0;
+  uint32_t press = xorshift(rng) % (4 * loopUs);
+  uint32_t release = press + 1000 + xorshift(rng) % (2 * loopUs);
+  uint32_t seen = 0;
+  bool held = false, actedOn = false;
+
+  while (seen < edges) {
+    // changes while the game slept (drawing doesn't poll, so a release
+    // during the draw is seen only now)
+    bool draw = false;
+    while (seen < edges && (held ? release : press) <= now) {
+      if (!held) {
+        r.poll(LAT_STICK_LEFT, press);
+        held = true;
+        actedOn = false;
+        continue;
+      }
+      r.poll(0, release);
+      held = false;
+      press = release + 1000 + xorshift(rng) % (4 * loopUs);
+      release = press + 1000 + xorshift(rng) % (2 * loopUs);
+      seen++;
+    }
+
+    // sample inputs at the top of the loop; act on a push once
+    if (held && !actedOn) {
+      actedOn = true;
+      draw = true;
+    }
+    now += drawMs * 1000;
+    if (draw) r.displayWrite(now);
+    now += periodMs * 1000;
+  }
+}
+
+int main(int argc, char **argv) {
+  LatencyRecorder r;
+  r.reset();
+  long maxMs = -1;
+
+  int i = 1;
+  if (i < argc && strcmp(argv[i], "--loop") == 0) {
+    if (argc < i + 3) {
+      fprintf(stderr, "usage: %s --loop <period_ms> <draw_ms> [edges] [seed]\n", argv[0]);
+      return 2;
+    }
+    uint32_t period = strtoul(argv[i + 1], 0, 10);
+    uint32_t draw = strtoul(argv[i + 2], 0, 10);
+    i += 3;
+    uint32_t edges = 1000, seed = 1;
+    if (i < argc && argv[i][0] != '-') edges = strtoul(argv[i++], 0, 10);
+    if (i < argc && argv[i][0] != '-') seed = strtoul(argv[i++], 0, 10);
+    replayLoop(r, period, draw, edges, seed);
+  } else {
+    replayTrace(r, stdin);
+  }
+  if (i + 1 < argc && strcmp(argv[i], "--max-ms") == 0) maxMs = atol(argv[i + 1]);
+
+  printf("n=%u dropped=%u max_us=%lu\n", r.samples, r.dropped, (unsigned long)r.maxUs);
+  for (uint8_t b = 0; b < LATENCY_BINS; b++)
+    printf("  >=%ums: %u\n", LatencyRecorder::binLowMs(b), r.bins[b]);
+
+  if (maxMs >= 0 && r.maxUs > (uint32_t)maxMs * 1000) return 1;
+  return 0;
+}
@@ -0,0 +1,326 @@
+// Packs Pac-Man mazes drawn as text into the console's level pack
+// (Gameboy/src/pacman/levelData.h, format described in level.h).
+//
+// Build (P=../Gameboy/src/pacman):
+//   g++ -O2 -std=c++11 -I$P -o pack_levels pack_levels.cpp
+//
+// Usage:
+//   pack_levels levels/*.txt > ../Gameboy/src/pacman/levelData.h
+//       Levels are played in the order given. One text row per maze row:
+//         #  wall            .  dot             o  power pellet
+//         (space) bare path  -  non-play area   P  pac-man's start
+//       Mazes can be up to Y_BOUND rows by X_BOUND columns and must be
+//       left/right symmetric (P counts as bare path and goes in the left
+//       half), have a ghost house with open space above its door, and be
+//       one connected maze without dead ends, with at most JG_MAX_NODES
+//       junctions. Anything else is reported and nothing is written.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "level.h"
+#include "exitMask.h"
+#include "junctionGraph.h"
+
+typedef std::vector<std::string> Maze;
+
+static const char *tileChars = "#.o -"; // indexed by kind
+
+// pac-man's start is bare path as far as the maze goes
+static int kindOf(char ch) {
+  if (ch == 'P') ch = ' ';
+  const char *p = strchr(tileChars, ch);
+  return ch && p ? (int)(p - tileChars) : -1;
+}
+
+static bool walkable(const Maze &m, int r, int c) {
+  if (r < 0 || r >= (int)m.size() || c < 0 || c >= (int)m[r].size()) return false;
+  char ch = m[r][c];
+  return ch != '#' && ch != '-';
+}
+
+static bool fail(const char *file, int row, const char *msg) {
+  if (row >= 0) fprintf(stderr, "%s:%d: %s\n", file, row + 1, msg);
+  else fprintf(stderr, "%s: %s\n", file, msg);
+  return false;
+}
+
+static bool readMaze(const char *file, Maze &m) {
+  FILE *f = fopen(file, "r");
+  if (!f) return fail(file, -1, "can't open");
+  char line[256];
+  while (fgets(line, sizeof line, f)) {
+    line[strcspn(line, "\r\n")] = 0;
+    m.push_back(line);
+  }
+  fclose(f);
+  while (!m.empty() && m.back().empty()) m.pop_back();
+  return true;
+}
+
+static bool checkMaze(const char *file, const Maze &m) {
+  if (m.empty() || m.size() > Y_BOUND) return fail(file, -1, "too many rows (see Y_BOUND)");
+  int cols = (int)m[0].size();
+  if (cols == 0 || cols > X_BOUND) return fail(file, 0, "row too wide (see X_BOUND)");
+
+  int spawns = 0, spawnRow = 0, spawnCol = 0, houseTop = -1, doorCol = 0;
+  for (int r = 0; r < (int)m.size(); r++) {
+    if ((int)m[r].size() != cols) return fail(file, r, "row width differs");
+    for (int c = 0; c < cols; c++) {
+      char a = m[r][c], b = m[r][cols - 1 - c];
+      if (kindOf(a) < 0) return fail(file, r, "unknown tile character");
+      if (a == 'P') {
+        if (2 * c >= cols) return fail(file, r, "P must be in the left half");
+        spawns++;
+        spawnRow = r;
+        spawnCol = c;
+        a = ' ';
+      }
+      if (b == 'P') b = ' ';
+      if (a != b) return fail(file, r, "row isn't symmetric");
+      if (m[r][c] == '-' && c > 0 && m[r][c - 1] != '-' && houseTop < 0 &&
+          2 * c < cols) {
+        houseTop = r;
+        doorCol = c;
+      }
+    }
+  }
+  if (spawns != 1) return fail(file, -1, "needs exactly one P");
+  if (houseTop < 1) return fail(file, -1, "no ghost house");
+  if (!walkable(m, houseTop - 1, doorCol))
+    return fail(file, houseTop - 1, "no path above the ghost house door");
+
+  // everything walkable must be reachable, and every tile needs a way on
+  // that isn't back the way it came
+  std::vector<std::vector<bool>> seen(m.size(), std::vector<bool>(cols, false));
+  std::vector<std::pair<int, int>> stack(1, std::make_pair(spawnRow, spawnCol));
+  seen[spawnRow][spawnCol] = true;
+  while (!stack.empty()) {
+    int r = stack.back().first, c = stack.back().second;
+    stack.pop_back();
+    int ways = 0;
+    for (int d = 0; d < 4; d++) {
+      int nr = r + rowStep(d), nc = c + colStep(d);
+      if (!walkable(m, nr, nc)) continue;
+      ways++;
+      if (!seen[nr][nc]) {
+        seen[nr][nc] = true;
+        stack.push_back(std::make_pair(nr, nc));
+      }
+    }
+    if (ways < 2) return fail(file, r, "dead end");
+  }
+  for (int r = 0; r < (int)m.size(); r++)
+    for (int c = 0; c < cols; c++)
+      if (walkable(m, r, c) && !seen[r][c])
+        return fail(file, r, "part of the maze can't be reached");
+  return true;
+}
+
+// left half of every row as runs, after the (rows, cols, pac-man's row
+// and column) header
+static std::vector<uint8_t> encode(const Maze &m) {
+  std::vector<uint8_t> out;
+  int cols = (int)m[0].size(), half = (cols + 1) / 2;
+  out.push_back((uint8_t)m.size());
+  out.push_back((uint8_t)cols);
+  for (size_t r = 0; r < m.size(); r++) {
+    size_t c = m[r].find('P');
+    if (c != std::string::npos) {
+      out.push_back((uint8_t)r);
+      out.push_back((uint8_t)c);
+    }
+  }
+  for (const std::string &row : m) {
+    for (int c = 0; c < half; ) {
+      int kind = kindOf(row[c]), len = 1;
+      while (c + len < half && len < LEVEL_MAX_RUN && kindOf(row[c + len]) == kind) len++;
+      out.push_back((uint8_t)(kind << LEVEL_KIND_SHIFT | (len - 1)));
+      c += len;
+    }
+  }
+  return out;
+}
+
+// every tile's exit mask (bit d set when direction d leads onto a
+// walkable tile), two tiles per byte with the lower index in the low
+// nibble
+static std::vector<uint8_t> exitMasks(const Maze &m) {
+  int cols = (int)m[0].size(), tiles = (int)m.size() * cols;
+  std::vector<uint8_t> out((tiles + 1) / 2, 0);
+  for (int i = 0; i < tiles; i++) {
+    int r = i / cols, c = i % cols, mask = 0;
+    for (int d = 0; d < 4; d++)
+      if (walkable(m, r + rowStep(d), c + colStep(d))) mask |= 1 << d;
+    out[i / 2] |= mask << (4 * (i % 2));
+  }
+  return out;
+}
+
+static int exitCount(const Maze &m, int r, int c) {
+  int n = 0;
+  for (int d = 0; d < 4; d++) n += walkable(m, r + rowStep(d), c + colStep(d));
+  return n;
+}
+
+static void put16(std::vector<uint8_t> &out, int v) {
+  out.push_back((uint8_t)(v & 0xFF));
+  out.push_back((uint8_t)(v >> 8));
+}
+
+// The junction graph, then the next-hop table if it fits in
+// LEVEL_NEXT_HOP_BUDGET (a single 0 byte if not); see level.h.
+// tableBytes is set to the table's size, 0 if it was left out.
+static bool routes(const char *file, const Maze &m, std::vector<uint8_t> &out,
+                   size_t &tableBytes) {
+  int rows = (int)m.size(), cols = (int)m[0].size();
+  std::vector<int> node(rows * cols, -1), column(rows * cols, -1), nodeTiles;
+  std::vector<int> rowStart;
+  int targets = 0;
+  for (int r = 0; r < rows; r++) {
+    rowStart.push_back(targets);
+    for (int c = 0; c < cols; c++) {
+      if (!walkable(m, r, c)) continue;
+      column[r * cols + c] = targets++;
+      if (exitCount(m, r, c) == 2) continue;
+      node[r * cols + c] = (int)nodeTiles.size();
+      nodeTiles.push_back(r * cols + c);
+    }
+  }
+  if (nodeTiles.empty()) return fail(file, -1, "no junctions");
+  if (nodeTiles.size() > JG_MAX_NODES) return fail(file, -1, "too many junctions (see JG_MAX_NODES)");
+
+  // every exit of a node runs down a corridor to the next node
+  out.push_back((uint8_t)nodeTiles.size());
+  for (int t : nodeTiles) put16(out, t);
+  for (int t : nodeTiles) {
+    for (int d = 0; d < 4; d++) {
+      int r = t / cols, c = t % cols, dir = d, len = 0;
+      if (!walkable(m, r + rowStep(d), c + colStep(d))) {
+        out.push_back(JG_NO_NODE);
+        out.push_back(0);
+        continue;
+      }
+      do {
+        r += rowStep(dir);
+        c += colStep(dir);
+        len++;
+        // a corridor tile has one way on that isn't back
+        int back = reverseDir(dir);
+        for (dir = 0; dir < 4; dir++)
+          if (dir != back && walkable(m, r + rowStep(dir), c + colStep(dir))) break;
+      } while (node[r * cols + c] < 0 && len < 256);
+      if (len > 255) return fail(file, t / cols, "corridor too long");
+      out.push_back((uint8_t)node[r * cols + c]);
+      out.push_back((uint8_t)len);
+    }
+  }
+
+  // next hop from every node to every walkable tile, 2 bits per entry
+  int rowBytes = (targets + 3) / 4;
+  tableBytes = nodeTiles.size() * rowBytes;
+  if (tableBytes > LEVEL_NEXT_HOP_BUDGET || rowBytes > 255) {
+    tableBytes = 0;
+    out.push_back(0);
+    return true;
+  }
+  std::vector<uint8_t> table(tableBytes, 0);
+  std::vector<int> dist(rows * cols), queue;
+  for (int dest = 0; dest < rows * cols; dest++) {
+    if (column[dest] < 0) continue;
+    // walking distance from every tile to dest
+    std::fill(dist.begin(), dist.end(), -1);
+    queue.assign(1, dest);
+    dist[dest] = 0;
+    for (size_t q = 0; q < queue.size(); q++) {
+      int r = queue[q] / cols, c = queue[q] % cols;
+      for (int d = 0; d < 4; d++) {
+        int nr = r + rowStep(d), nc = c + colStep(d);
+        if (walkable(m, nr, nc) && dist[nr * cols + nc] < 0) {
+          dist[nr * cols + nc] = dist[queue[q]] + 1;
+          queue.push_back(nr * cols + nc);
+        }
+      }
+    }
+    for (size_t n = 0; n < nodeTiles.size(); n++) {
+      int t = nodeTiles[n], r = t / cols, c = t % cols, d = 0;
+      if (t == dest) continue;
+      while (!walkable(m, r + rowStep(d), c + colStep(d)) ||
+             dist[(r + rowStep(d)) * cols + c + colStep(d)] != dist[t] - 1) d++;
+      int i = column[dest];
+      table[n * rowBytes + i / 4] |= d << (2 * (i % 4));
+    }
+  }
+  out.push_back((uint8_t)rowBytes);
+  for (int r = 0; r < rows; r++) put16(out, rowStart[r]);
+  out.insert(out.end(), table.begin(), table.end());
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s maze.txt... > levelData.h\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<std::vector<uint8_t>> packed, masks, routing;
+  std::vector<size_t> tables;
+  size_t raw = 0, maskBytes = 0, routeBytes = 0;
+  for (int i = 1; i < argc; i++) {
+    Maze m;
+    if (!readMaze(argv[i], m) || !checkMaze(argv[i], m)) return 1;
+    packed.push_back(encode(m));
+    masks.push_back(exitMasks(m));
+    routing.push_back(std::vector<uint8_t>());
+    tables.push_back(0);
+    if (!routes(argv[i], m, routing.back(), tables.back())) return 1;
+    raw += m.size() * m[0].size();
+    maskBytes += masks.back().size();
+    routeBytes += routing.back().size();
+  }
+
+  size_t total = 0;
+  printf("/*Pac-Man mazes, generated by host/pack_levels.cpp - do not edit*/\n");
+  printf("#ifndef LEVELDATA_H\n#define LEVELDATA_H\n");
+  printf("#include \"../platform.h\"\n\n");
+  printf("#define LEVEL_COUNT %zu\n\n", packed.size());
+  printf("// where each level starts in levelData\n");
+  printf("static const uint16_t levelStart[LEVEL_COUNT] PROGMEM = {");
+  for (size_t i = 0; i < packed.size(); i++) {
+    printf("%s%zu", i ? ", " : "", total);
+    total += packed[i].size() + masks[i].size() + routing[i].size();
+  }
+  printf("};\n\n");
+
+  printf("static const uint8_t levelData[] PROGMEM = {\n");
+  for (size_t i = 0; i < packed.size(); i++) {
+    const std::vector<uint8_t> &p = packed[i];
+    const char *name = strrchr(argv[i + 1], '/');
+    printf("  // %s\n  %u, %u, %u, %u,", name ? name + 1 : argv[i + 1],
+           p[0], p[1], p[2], p[3]);
+    for (size_t j = 4; j < p.size(); j++)
+      printf("%s0x%02X,", (j - 4) % 12 ? " " : "\n  ", p[j]);
+    printf("\n  // exit masks");
+    for (size_t j = 0; j < masks[i].size(); j++)
+      printf("%s0x%02X,", j % 12 ? " " : "\n  ", masks[i][j]);
+    const std::vector<uint8_t> &g = routing[i];
+    size_t graphBytes = 1 + 10 * g[0];  // count, tiles and edges
+    printf("\n  // junction graph, %u nodes", g[0]);
+    for (size_t j = 0; j < graphBytes; j++)
+      printf("%s0x%02X,", j % 12 ? " " : "\n  ", g[j]);
+    printf(tables[i] ? "\n  // next-hop table" : "\n  // no next-hop table");
+    for (size_t j = graphBytes; j < g.size(); j++)
+      printf("%s0x%02X,", (j - graphBytes) % 12 ? " " : "\n  ", g[j]);
+    printf("\n");
+  }
+  printf("};\n\n#endif\n");
+
+  fprintf(stderr, "%zu levels, %zu bytes (%zu unpacked), %zu of them exit "
+          "masks and %zu routing\n", packed.size(), total, raw, maskBytes, routeBytes);
+  for (size_t i = 0; i < packed.size(); i++)
+    fprintf(stderr, "  %s: %u junctions, next-hop table %zu bytes\n", argv[i + 1],
+            routing[i][0], tables[i]);
+  return 0;
+}
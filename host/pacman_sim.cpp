@@ -0,0 +1,52 @@
+// Runs the console's Pac-Man rules (Gameboy/src/pacman/core.h) headless,
+// as fast as the PC allows, with a scripted player. Use it to check that
+// rule changes still play out the same, and how fast the core runs.
+//
+// Build (P=../Gameboy/src/pacman):
+//   g++ -O2 -std=c++11 -I$P -o pacman_sim pacman_sim.cpp $P/core.cpp
+//       $P/pacMan.cpp $P/ghost.cpp $P/actor.cpp $P/level.cpp
+//       $P/distanceField.cpp $P/game.cpp $P/autopilot.cpp
+//       $P/nextHop.cpp $P/junctionGraph.cpp
+//
+// Usage:
+//   pacman_sim [--autopilot] [games] [seed] [max_ticks]
+//       Plays games in a row, each with the next seed. The player turns
+//       a random way now and then, or with --autopilot is the console's
+//       attract-mode bot. Prints one line per game and the overall speed
+//       in ticks per second.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "core.h"
+#include "sim_players.h"
+
+int main(int argc, char **argv) {
+  bool autopilot = takeAutopilotFlag(argc, argv);
+  uint32_t games = argc > 1 ? strtoul(argv[1], 0, 10) : 100;
+  uint32_t seed = argc > 2 ? strtoul(argv[2], 0, 10) : 1;
+  uint32_t maxTicks = argc > 3 ? strtoul(argv[3], 0, 10) : 100000;
+
+  static PacManCore core;
+  CoreConfig cfg = CoreConfig::defaults();
+  uint64_t totalTicks = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  printf("seed,ticks,score,lives,level\n");
+  for (uint32_t g = 0; g < games; g++) {
+    uint32_t rng = seed + g ? seed + g : 1;
+    core.reset(cfg);
+    while (!core.game.isGameOver() && core.tick < maxTicks) {
+      core.step(playerInput(core, rng, autopilot));
+    }
+    totalTicks += core.tick;
+    printf("%u,%u,%d,%d,%d\n", seed + g, core.tick, core.game.getScore(),
+           core.game.getRemainingLives(), core.level + 1);
+  }
+  double secs = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  fprintf(stderr, "%llu ticks in %.2fs (%.0f ticks/s)\n",
+          (unsigned long long)totalTicks, secs, secs > 0 ? totalTicks / secs : 0.0);
+  return 0;
+}
@@ -0,0 +1,128 @@
+// Sweeps Pac-Man ghost difficulty settings on the headless core
+// (Gameboy/src/pacman/core.h). Thousands of seeded games are played per
+// setting on every core, and the survival time and score distributions
+// come out as CSV, ready for a spreadsheet or plotting script.
+//
+// Build (P=../Gameboy/src/pacman):
+//   g++ -O2 -std=c++11 -pthread -I$P -o pacman_sweep pacman_sweep.cpp
+//       $P/core.cpp $P/pacMan.cpp $P/ghost.cpp $P/actor.cpp
+//       $P/level.cpp $P/distanceField.cpp $P/game.cpp $P/autopilot.cpp
+//       $P/nextHop.cpp $P/junctionGraph.cpp
+//
+// Usage:
+//   pacman_sweep [--autopilot] [games_per_setting] [seed] [threads] > sweep.csv
+//       threads 0 (the default) uses every core. Game g of every setting
+//       uses seed + g, so settings are compared on the same players.
+//       --autopilot plays with the console's bot instead of random turns.
+//
+// The swept settings are red's speed, the other ghosts' speed and the
+// power pellet duration; everything else stays at CoreConfig::defaults().
+// Speeds are sub-tile units per frame and must divide SUBTILE.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "core.h"
+#include "sim_players.h"
+#include "work_pool.h"
+
+// games longer than this are cut off and counted as survived
+#define MAX_TICKS 200000
+// games per pool task
+#define CHUNK 25
+
+static const int16_t redSpeeds[] = {2, 4, 5, 8};
+static const int16_t ghostSpeeds[] = {2, 4, 5, 8};
+static const uint16_t powerTicks[] = {100, 200, 300};
+
+struct Setting {
+  CoreConfig cfg;
+  std::vector<uint32_t> ticks;
+  std::vector<int16_t> scores;
+  std::vector<uint8_t> won;
+};
+
+static bool autopilot = false;
+
+static void playGames(Setting &s, uint32_t first, uint32_t count, uint32_t seed) {
+  PacManCore core;
+  for (uint32_t g = first; g < first + count; g++) {
+    uint32_t rng = seed + g ? seed + g : 1;
+    core.reset(s.cfg);
+    while (!core.game.isGameOver() && core.tick < MAX_TICKS) {
+      core.step(playerInput(core, rng, autopilot));
+    }
+    // each game writes only its own slot, so no locking is needed
+    s.ticks[g] = core.tick;
+    s.scores[g] = core.game.getScore();
+    s.won[g] = core.game.hasWon();
+  }
+}
+
+// value below which fraction p of the sorted samples fall
+template <typename T>
+static T quantile(const std::vector<T> &sorted, double p) {
+  return sorted[(size_t)(p * (sorted.size() - 1) + 0.5)];
+}
+
+template <typename T>
+static void printDistribution(std::vector<T> v) {
+  std::sort(v.begin(), v.end());
+  double sum = 0;
+  for (T x : v) sum += x;
+  printf(",%.1f,%ld,%ld,%ld,%ld", sum / v.size(), (long)quantile(v, 0.1),
+         (long)quantile(v, 0.5), (long)quantile(v, 0.9), (long)v.back());
+}
+
+int main(int argc, char **argv) {
+  autopilot = takeAutopilotFlag(argc, argv);
+  uint32_t games = argc > 1 ? strtoul(argv[1], 0, 10) : 1000;
+  uint32_t seed = argc > 2 ? strtoul(argv[2], 0, 10) : 1;
+  unsigned threads = argc > 3 ? strtoul(argv[3], 0, 10) : 0;
+  if (games == 0) games = 1;
+
+  std::vector<Setting> settings;
+  for (int16_t r : redSpeeds)
+    for (int16_t g : ghostSpeeds)
+      for (uint16_t p : powerTicks) {
+        Setting s;
+        s.cfg = CoreConfig::defaults();
+        s.cfg.ghostSpeed[Shadow] = r;
+        s.cfg.ghostSpeed[Speedy] = s.cfg.ghostSpeed[Bashful] =
+            s.cfg.ghostSpeed[Pokey] = g;
+        s.cfg.powerTicks = p;
+        s.ticks.resize(games);
+        s.scores.resize(games);
+        s.won.resize(games);
+        settings.push_back(s);
+      }
+
+  {
+    WorkPool pool(threads);
+    fprintf(stderr, "%zu settings x %u games on %u threads\n", settings.size(),
+            games, pool.size());
+    for (Setting &s : settings) {
+      for (uint32_t g = 0; g < games; g += CHUNK) {
+        uint32_t count = std::min<uint32_t>(CHUNK, games - g);
+        Setting *sp = &s;
+        pool.submit([sp, g, count, seed] { playGames(*sp, g, count, seed); });
+      }
+    }
+    pool.wait();
+  }
+
+  printf("red_speed,ghost_speed,power_ticks,games,wins,"
+         "ticks_mean,ticks_p10,ticks_p50,ticks_p90,ticks_max,"
+         "score_mean,score_p10,score_p50,score_p90,score_max\n");
+  for (Setting &s : settings) {
+    uint32_t wins = 0;
+    for (uint8_t w : s.won) wins += w;
+    printf("%d,%d,%u,%u,%u", s.cfg.ghostSpeed[Shadow], s.cfg.ghostSpeed[Speedy],
+           s.cfg.powerTicks, games, wins);
+    printDistribution(s.ticks);
+    printDistribution(s.scores);
+    printf("\n");
+  }
+  return 0;
+}
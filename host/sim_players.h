@@ -0,0 +1,49 @@
+// Stand-in players for the host tools that run the Pac-Man core.
+#ifndef SIM_PLAYERS_H
+#define SIM_PLAYERS_H
+
+#include <stdint.h>
+#include <string.h>
+#include "core.h"
+#include "controller.h"
+#include "autopilot.h"
+
+static inline uint32_t xorshift(uint32_t &s) {
+  s ^= s << 13;
+  s ^= s >> 17;
+  s ^= s << 5;
+  return s;
+}
+
+// turns a random way roughly every 16 frames
+static inline int scriptedInput(uint32_t &rng) {
+  uint32_t r = xorshift(rng);
+  if (r % 16) return NEUTRAL;
+  return (r >> 8) % 4;
+}
+
+// the console's autopilot, with a random turn roughly every 64 frames so
+// different seeds play different games
+static inline int autopilotInput(PacManCore &core, uint32_t &rng) {
+  uint32_t r = xorshift(rng);
+  if (r % 64 == 0) return (r >> 8) % 4;
+  return autopilotDirection(core);
+}
+
+// input for one frame from the chosen player
+static inline int playerInput(PacManCore &core, uint32_t &rng, bool autopilot) {
+  return autopilot ? autopilotInput(core, rng) : scriptedInput(rng);
+}
+
+// drop "--autopilot" from the arguments; true if it was there
+static inline bool takeAutopilotFlag(int &argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--autopilot") != 0) continue;
+    for (int j = i; j + 1 < argc; j++) argv[j] = argv[j + 1];
+    argc--;
+    return true;
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,91 @@
+// Plays seeded Tetris games headless with the console's computer player
+// (Gameboy/src/tetris/ai.h) on the console's own well code, as fast as
+// the PC allows. Use it to see how well the player does and how fast the
+// well operations and the placement search run.
+//
+// Build (T=../Gameboy/src/tetris):
+//   g++ -O2 -std=c++11 -I$T -o tetris_bench tetris_bench.cpp $T/well.cpp
+//       $T/ai.cpp
+//
+// Usage:
+//   tetris_bench [--no-lookahead] [games] [seed] [max_pieces]
+//       Plays games in a row, each with the next seed. The player looks
+//       ahead to the next piece unless told not to. Prints one line per
+//       game, then the overall speed in placements (well copy, drop,
+//       clear and score) and pieces per second.
+//   tetris_bench --full-well
+//       Checks that the player gives up (no rotation picked) on a well
+//       filled to the top, for every piece with and without looking
+//       ahead. Exits non-zero if it picks a placement anyway.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "tetris_sim.h"
+
+// drop flag from the arguments; true if it was there
+static bool takeFlag(const char *flag, int &argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], flag) != 0) continue;
+    for (int j = i; j + 1 < argc; j++) argv[j] = argv[j + 1];
+    argc--;
+    return true;
+  }
+  return false;
+}
+
+// a search on a well with no room left must finish without a placement
+static int checkFullWell() {
+  static Well well;
+  well.clear();
+  for (int8_t y = 0; y < WELL_HEIGHT; y++) well.rows[y] = WELL_FULL;
+  well.measure();
+
+  int failures = 0;
+  AiSearch search;
+  for (uint8_t type = 0; type < PIECE_TYPES; type++) {
+    for (int8_t next = AI_NO_PIECE; next < PIECE_TYPES; next++) {
+      search.begin(well, type, next, aiWeights);
+      search.step(0xFFFF);
+      if (!search.done || search.bestRotation != -1) {
+        printf("piece %u next %d: done %d, rotation %d, x %d\n", type, next,
+               search.done, search.bestRotation, search.bestX);
+        failures++;
+      }
+    }
+  }
+  printf("full well: %s\n", failures ? "FAIL" : "ok");
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  if (takeFlag("--full-well", argc, argv)) return checkFullWell();
+  bool lookahead = !takeFlag("--no-lookahead", argc, argv);
+  uint32_t games = argc > 1 ? strtoul(argv[1], 0, 10) : 100;
+  uint32_t seed = argc > 2 ? strtoul(argv[2], 0, 10) : 1;
+  uint32_t maxPieces = argc > 3 ? strtoul(argv[3], 0, 10) : 100000;
+
+  static TetrisSim sim;
+  uint64_t totalPieces = 0, totalPlacements = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  printf("seed,pieces,lines,score\n");
+  for (uint32_t g = 0; g < games; g++) {
+    sim.reset(seed + g);
+    while (sim.pieces < maxPieces) {
+      if (!sim.play(aiWeights, lookahead)) break;
+    }
+    totalPieces += sim.pieces;
+    totalPlacements += sim.placements;
+    printf("%u,%u,%u,%u\n", seed + g, sim.pieces, sim.lines, sim.score());
+  }
+  double secs = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  fprintf(stderr, "%llu pieces, %llu placements in %.2fs "
+          "(%.0f pieces/s, %.0f placements/s)\n",
+          (unsigned long long)totalPieces, (unsigned long long)totalPlacements,
+          secs, secs > 0 ? totalPieces / secs : 0.0,
+          secs > 0 ? totalPlacements / secs : 0.0);
+  return 0;
+}
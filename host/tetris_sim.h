@@ -0,0 +1,60 @@
+// Headless Tetris for the host tools: the console's well, pieces and
+// computer player (Gameboy/src/tetris), one placement at a time.
+#ifndef TETRIS_SIM_H
+#define TETRIS_SIM_H
+
+#include <stdint.h>
+#include "well.h"
+#include "pieces.h"
+#include "ai.h"
+
+static inline uint32_t xorshift(uint32_t &s) {
+  s ^= s << 13;
+  s ^= s >> 17;
+  s ^= s << 5;
+  return s;
+}
+
+// One game with the same rules as tetrisLoop: pieces drawn uniformly at
+// random, dropped where the computer player picks, 10 points a line, and
+// the game is over once anything is left in the top two rows. Gravity
+// and the controls aren't simulated; a piece goes straight to its spot.
+struct TetrisSim {
+  Well well;
+  AiSearch search;
+  uint32_t rng;
+  uint8_t type, next;
+  uint32_t pieces, lines, placements;
+  bool over;
+
+  void reset(uint32_t seed) {
+    well.clear();
+    rng = seed ? seed : 1;
+    next = xorshift(rng) % PIECE_TYPES;
+    pieces = lines = placements = 0;
+    over = false;
+  }
+
+  uint32_t score() const { return 10 * lines; }
+
+  // drop the next piece; false once the game is over
+  bool play(const AiWeights &weights, bool lookahead) {
+    type = next;
+    next = xorshift(rng) % PIECE_TYPES;
+
+    search.begin(well, type, lookahead ? next : AI_NO_PIECE, weights);
+    search.step(0xFFFF);  // no frames to spread it over here
+    placements += search.placements;
+    if (search.bestRotation < 0) return !(over = true);
+
+    uint16_t shape = pieceMask(type, search.bestRotation);
+    int8_t y = well.dropRow(shape, search.bestX, 0);
+    well.place(shape, search.bestX, y, type + 1);
+    lines += well.clearFullRows(y, y + SHAPE_ROWS - 1);
+    pieces++;
+    over = well.rows[0] || well.rows[1];
+    return !over;
+  }
+};
+
+#endif
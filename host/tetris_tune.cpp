@@ -0,0 +1,204 @@
+// Tunes the Tetris computer player's heuristic weights
+// (Gameboy/src/tetris/aiWeights.h) by self-play on every core. Each
+// generation draws a population of weight vectors around the current
+// mean, plays the same seeded games with every one of them on the
+// headless game (tetris_sim.h), and moves the mean and spread to the
+// best quarter (the cross-entropy method).
+//
+// Build (T=../Gameboy/src/tetris):
+//   g++ -O2 -std=c++11 -pthread -I$T -o tetris_tune tetris_tune.cpp
+//       $T/well.cpp $T/ai.cpp
+//
+// Usage:
+//   tetris_tune [--lookahead] [generations] [games] [seed] [threads] [header]
+//       Plays games per candidate per generation (game g of generation n
+//       uses seed + n * games + g, the same for every candidate). threads
+//       0 (the default) uses every core. Games stop at MAX_PIECES, so a
+//       candidate's fitness is the mean lines cleared within that many
+//       pieces. One CSV line per generation goes to stdout, the games/s
+//       to stderr. With a header path (e.g. ../Gameboy/src/tetris/
+//       aiWeights.h) the final mean is written there for the console.
+//       --lookahead tunes the player as the console runs it, looking
+//       ahead to the next piece; it's about 25 times slower.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "tetris_sim.h"
+#include "work_pool.h"
+
+// candidates per generation, and how many of the best the next one is
+// drawn around
+#define POPULATION 32
+#define ELITE 8
+// games are cut off after this many pieces
+#define MAX_PIECES 2000
+// games per pool task
+#define CHUNK 25
+// weight vectors are scaled to this length; only their direction
+// matters to the player
+#define WEIGHT_NORM 1000.0
+// added to the spread each generation so it doesn't collapse early,
+// shrinking as the search goes on
+#define EXTRA_SPREAD 100.0
+
+#define NUM_WEIGHTS 4
+
+struct Candidate {
+  double w[NUM_WEIGHTS];
+  AiWeights weights;
+  std::vector<uint32_t> lines;
+  double fitness;
+};
+
+static bool lookahead = false;
+
+static AiWeights toWeights(const double *w) {
+  AiWeights k;
+  k.height = (int16_t)lround(w[0]);
+  k.lines = (int16_t)lround(w[1]);
+  k.holes = (int16_t)lround(w[2]);
+  k.bumpiness = (int16_t)lround(w[3]);
+  return k;
+}
+
+static void normalize(double *w) {
+  double len = 0;
+  for (int i = 0; i < NUM_WEIGHTS; i++) len += w[i] * w[i];
+  len = sqrt(len);
+  if (len == 0) return;
+  for (int i = 0; i < NUM_WEIGHTS; i++) w[i] *= WEIGHT_NORM / len;
+}
+
+static void playGames(Candidate &c, uint32_t first, uint32_t count, uint32_t seed) {
+  TetrisSim sim;
+  for (uint32_t g = first; g < first + count; g++) {
+    sim.reset(seed + g);
+    while (sim.pieces < MAX_PIECES) {
+      if (!sim.play(c.weights, lookahead)) break;
+    }
+    // each game writes only its own slot, so no locking is needed
+    c.lines[g] = sim.lines;
+  }
+}
+
+// drop "--lookahead" from the arguments; true if it was there
+static bool takeLookaheadFlag(int &argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--lookahead") != 0) continue;
+    for (int j = i; j + 1 < argc; j++) argv[j] = argv[j + 1];
+    argc--;
+    return true;
+  }
+  return false;
+}
+
+static bool writeHeader(const char *path, const AiWeights &k, uint32_t generations,
+                        uint32_t games) {
+  FILE *f = fopen(path, "w");
+  if (!f) return false;
+  fprintf(f,
+          "/*Heuristic weights for the Tetris computer player*/\n"
+          "#ifndef AI_WEIGHTS_H\n"
+          "#define AI_WEIGHTS_H\n"
+          "\n"
+          "// { height, lines, holes, bumpiness } in thousandths, see AiWeights in\n"
+          "// ai.h. Written by host/tetris_tune (%u generations of %u games%s).\n"
+          "#define AI_WEIGHTS { %d, %d, %d, %d }\n"
+          "\n"
+          "#endif\n",
+          generations, games, lookahead ? ", looking ahead" : "",
+          k.height, k.lines, k.holes, k.bumpiness);
+  return fclose(f) == 0;
+}
+
+int main(int argc, char **argv) {
+  lookahead = takeLookaheadFlag(argc, argv);
+  uint32_t generations = argc > 1 ? strtoul(argv[1], 0, 10) : 10;
+  uint32_t games = argc > 2 ? strtoul(argv[2], 0, 10) : 1000;
+  uint32_t seed = argc > 3 ? strtoul(argv[3], 0, 10) : 1;
+  unsigned threads = argc > 4 ? strtoul(argv[4], 0, 10) : 0;
+  const char *header = argc > 5 ? argv[5] : 0;
+  if (games == 0) games = 1;
+
+  // start from the weights the console has now
+  double mean[NUM_WEIGHTS] = {(double)aiWeights.height, (double)aiWeights.lines,
+                              (double)aiWeights.holes, (double)aiWeights.bumpiness};
+  double spread[NUM_WEIGHTS] = {300, 300, 300, 300};
+  normalize(mean);
+
+  std::mt19937 rng(seed);
+  std::vector<Candidate> population(POPULATION);
+  WorkPool pool(threads);
+  fprintf(stderr, "%d candidates x %u games on %u threads\n", POPULATION, games,
+          pool.size());
+
+  printf("generation,best_lines,elite_lines,height,lines,holes,bumpiness\n");
+  for (uint32_t n = 0; n < generations; n++) {
+    // candidate 0 is the mean itself, so progress shows on the same games
+    for (int c = 0; c < POPULATION; c++) {
+      Candidate &cand = population[c];
+      for (int i = 0; i < NUM_WEIGHTS; i++) {
+        std::normal_distribution<double> d(mean[i], spread[i]);
+        cand.w[i] = c == 0 ? mean[i] : d(rng);
+      }
+      normalize(cand.w);
+      cand.weights = toWeights(cand.w);
+      cand.lines.assign(games, 0);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint32_t genSeed = seed + n * games;
+    for (Candidate &cand : population) {
+      for (uint32_t g = 0; g < games; g += CHUNK) {
+        uint32_t count = std::min<uint32_t>(CHUNK, games - g);
+        Candidate *cp = &cand;
+        pool.submit([cp, g, count, genSeed] { playGames(*cp, g, count, genSeed); });
+      }
+    }
+    pool.wait();
+    double secs = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    for (Candidate &cand : population) {
+      double sum = 0;
+      for (uint32_t l : cand.lines) sum += l;
+      cand.fitness = sum / games;
+    }
+    std::sort(population.begin(), population.end(),
+              [](const Candidate &a, const Candidate &b) { return a.fitness > b.fitness; });
+
+    // refit the mean and spread to the elite
+    double eliteLines = 0;
+    for (int i = 0; i < NUM_WEIGHTS; i++) {
+      double m = 0, v = 0;
+      for (int e = 0; e < ELITE; e++) m += population[e].w[i];
+      m /= ELITE;
+      for (int e = 0; e < ELITE; e++) v += (population[e].w[i] - m) * (population[e].w[i] - m);
+      mean[i] = m;
+      spread[i] = sqrt(v / ELITE) + EXTRA_SPREAD / (n + 1);
+    }
+    for (int e = 0; e < ELITE; e++) eliteLines += population[e].fitness;
+    normalize(mean);
+
+    AiWeights k = toWeights(mean);
+    printf("%u,%.1f,%.1f,%d,%d,%d,%d\n", n, population[0].fitness, eliteLines / ELITE,
+           k.height, k.lines, k.holes, k.bumpiness);
+    fflush(stdout);
+    fprintf(stderr, "generation %u: %.0f games/s\n", n,
+            secs > 0 ? POPULATION * games / secs : 0.0);
+  }
+
+  if (header) {
+    if (!writeHeader(header, toWeights(mean), generations, games)) {
+      fprintf(stderr, "can't write %s\n", header);
+      return 1;
+    }
+    fprintf(stderr, "wrote %s\n", header);
+  }
+  return 0;
+}
@@ -0,0 +1,154 @@
+// Plays the other side of Tetris VS (Gameboy/src/tetris/versus.h) with
+// the console's computer player, over a serial port, using the console's
+// own link and versus code. Point it at a console's USB serial port to
+// play against it, or run two of them on a pseudo-terminal pair to try
+// the protocol with no console at all.
+//
+// Build (T=../Gameboy/src/tetris):
+//   g++ -O2 -std=c++11 -I$T -o tetris_versus tetris_versus.cpp
+//       $T/well.cpp $T/ai.cpp $T/link.cpp $T/versus.cpp
+//
+// Usage:
+//   tetris_versus [port|-] [games] [ms_per_piece] [seed]
+//       port is a serial device (set to 9600 baud, raw), e.g.
+//       /dev/ttyACM0. With "-" or no port it opens a pseudo-terminal and
+//       prints the path to start a second tetris_versus on. Waits for
+//       the other side, then plays games rounds against it, dropping a
+//       piece every ms_per_piece (default 250). Prints one line per
+//       round, then the link's dropped and missing frame counts and any
+//       bytes lost to write errors.
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <chrono>
+#include "tetris_sim.h"
+#include "versus.h"
+
+// give the other side this long to hear about the end of a round
+#define ROUND_GAP_MS 2000
+
+static int port = -1;
+static Versus versus;
+static int pending = -1;     // byte taken from the link the port had no room for
+static uint32_t writeErrors;  // bytes lost to a failed write
+
+static unsigned long millisNow() {
+  using namespace std::chrono;
+  static steady_clock::time_point start = steady_clock::now();
+  return duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+static bool makeRaw(int fd) {
+  termios tio;
+  if (tcgetattr(fd, &tio) != 0) return false;
+  cfmakeraw(&tio);
+  cfsetispeed(&tio, B9600);
+  cfsetospeed(&tio, B9600);
+  return tcsetattr(fd, TCSANOW, &tio) == 0;
+}
+
+// the given port, or a new pseudo-terminal whose other end is printed
+static int openPort(const char *path) {
+  int fd;
+  if (path && strcmp(path, "-") != 0) {
+    fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) { perror(path); return -1; }
+  } else {
+    fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+      perror("pseudo-terminal");
+      return -1;
+    }
+    int other = open(ptsname(fd), O_RDWR | O_NOCTTY);  // raw before the peer opens it
+    if (other >= 0) { makeRaw(other); close(other); }
+    printf("other side: tetris_versus %s\n", ptsname(fd));
+    fflush(stdout);
+  }
+  makeRaw(fd);
+  return fd;
+}
+
+// the same glue as versusPoll() on the console: move bytes both ways as
+// far as each side has room, never waiting
+static void pump() {
+  unsigned long now = millisNow();
+  uint8_t in[64];
+  ssize_t n;
+  while ((n = read(port, in, sizeof in)) > 0) {
+    for (ssize_t i = 0; i < n; i++) versus.receive(in[i], now);
+  }
+  versus.poll(now);
+  while (pending >= 0 || versus.link.txPending()) {
+    if (pending < 0) pending = versus.link.txByte();
+    uint8_t byte = (uint8_t)pending;
+    ssize_t w = write(port, &byte, 1);
+    if (w < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+      writeErrors++;  // the link copes with a lost byte
+    } else if (w != 1) {
+      return;  // port is full; try the same byte next pump()
+    }
+    pending = -1;
+  }
+}
+
+static void waitPumping(unsigned long ms) {
+  unsigned long start = millisNow();
+  while (millisNow() - start < ms) {
+    pump();
+    usleep(1000);
+  }
+}
+
+int main(int argc, char **argv) {
+  uint32_t games = argc > 2 ? strtoul(argv[2], 0, 10) : 3;
+  uint32_t msPerPiece = argc > 3 ? strtoul(argv[3], 0, 10) : 250;
+  uint32_t seed = argc > 4 ? strtoul(argv[4], 0, 10) : (uint32_t)getpid();
+  port = openPort(argc > 1 ? argv[1] : 0);
+  if (port < 0) return 1;
+
+  versus.begin(millisNow());
+  while (!versus.peerSeen) waitPumping(10);
+
+  static TetrisSim sim;
+  uint32_t wins = 0;
+  for (uint32_t g = 0; g < games; g++) {
+    sim.reset(seed + g);
+    versus.newRound();
+    versus.sendWell(sim.well);
+    uint32_t received = 0;
+    bool won = false;
+
+    while (!sim.over) {
+      waitPumping(msPerPiece);
+      if ((won = versus.won())) break;
+
+      uint32_t lines = sim.lines;
+      sim.play(aiWeights, true);
+      uint8_t rows = versus.lock(sim.lines - lines);
+      if (rows) {
+        received += rows;
+        if (sim.well.raise(rows, xorshift(sim.rng) % WELL_WIDTH)) sim.over = true;
+        if (sim.well.rows[0] || sim.well.rows[1]) sim.over = true;
+      }
+      versus.sendWell(sim.well);
+    }
+    if (!won) versus.topOut();
+    wins += won;
+
+    printf("round %u: %s after %u pieces, %u lines, garbage sent %u "
+           "received %u%s\n", g + 1, won ? "won" : "lost", sim.pieces,
+           sim.lines, versus.garbageSent, received,
+           versus.linked(millisNow()) ? "" : " (other side gone)");
+    fflush(stdout);
+    waitPumping(ROUND_GAP_MS);
+  }
+
+  printf("won %u of %u; frames dropped %u, missing %u, write errors %u\n",
+         wins, games, versus.link.badFrames, versus.link.lostFrames, writeErrors);
+  close(port);
+  return 0;
+}
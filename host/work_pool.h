@@ -0,0 +1,127 @@
+// Small work-stealing thread pool for the host tools.
+//
+// Every worker owns a queue. submit() deals tasks round-robin; a worker
+// takes its newest task first and, when its own queue runs dry, steals
+// the oldest task from another worker. Long and short tasks therefore
+// even out across cores without a single shared queue becoming the
+// bottleneck.
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkPool {
+ public:
+  // threads == 0 uses one worker per hardware thread
+  explicit WorkPool(unsigned threads = 0) : queued(0), pending(0), next(0), stopping(false) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    for (unsigned i = 0; i < threads; i++) queues.emplace_back(new Queue);
+    for (unsigned i = 0; i < threads; i++) workers.emplace_back(&WorkPool::run, this, i);
+  }
+
+  ~WorkPool() {
+    wait();
+    {
+      std::lock_guard<std::mutex> lock(idleMutex);
+      stopping = true;
+    }
+    idle.notify_all();
+    for (auto &t : workers) t.join();
+  }
+
+  WorkPool(const WorkPool &) = delete;
+  WorkPool &operator=(const WorkPool &) = delete;
+
+  unsigned size() const { return (unsigned)workers.size(); }
+
+  // queue a task; it may run on any worker
+  void submit(std::function<void()> task) {
+    // count first so a worker can never take a task before it's counted
+    {
+      std::lock_guard<std::mutex> lock(idleMutex);
+      pending++;
+      queued++;
+    }
+    Queue &q = *queues[next++ % queues.size()];
+    {
+      std::lock_guard<std::mutex> lock(q.mutex);
+      q.tasks.push_back(std::move(task));
+    }
+    idle.notify_one();
+  }
+
+  // block until every submitted task has finished
+  void wait() {
+    std::unique_lock<std::mutex> lock(idleMutex);
+    done.wait(lock, [this] { return pending == 0; });
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> workers;
+
+  // guarded by idleMutex
+  std::mutex idleMutex;
+  std::condition_variable idle; // work arrived or the pool is stopping
+  std::condition_variable done; // pending reached zero
+  size_t queued;                // tasks sitting in a queue
+  size_t pending;               // tasks queued or running
+
+  std::atomic<unsigned> next;   // round-robin cursor for submit()
+  bool stopping;
+
+  // own queue newest-first, then the others oldest-first
+  bool take(unsigned self, std::function<void()> &out) {
+    for (unsigned i = 0; i < queues.size(); i++) {
+      Queue &q = *queues[(self + i) % queues.size()];
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (q.tasks.empty()) continue;
+      if (i == 0) {
+        out = std::move(q.tasks.back());
+        q.tasks.pop_back();
+      } else {
+        out = std::move(q.tasks.front());
+        q.tasks.pop_front();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  void run(unsigned self) {
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(idleMutex);
+        idle.wait(lock, [this] { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+      }
+
+      std::function<void()> task;
+      if (!take(self, task)) continue; // someone else got there first
+      {
+        std::lock_guard<std::mutex> lock(idleMutex);
+        queued--;
+      }
+
+      task();
+
+      std::lock_guard<std::mutex> lock(idleMutex);
+      if (--pending == 0) done.notify_all();
+    }
+  }
+};
+
+#endif